@@ -0,0 +1,1273 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Benchmark/ProjectileManagerBenchmark.h"
+#include "ProjectileManager/Public/Manager/ProjectileManagerBase.h"
+#include "ProjectileManager/Public/Pool/ProjectilePool.h"
+#include "ProjectileManager/Public/Pool/ProjectileFreeSlotStack.h"
+#include "ProjectileManager/Public/Simulation/ProjectileBallisticKernel.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/StaticMesh.h"
+#include "EngineUtils.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Benchmark Helpers												-
+//-----------------------------------------------------------------------------------
+namespace ProjectileManagerBenchmark
+{
+	/* The pull every measurement uses, the projectiles stay where they are put */
+	static FProjectilePoolRequest MakePullRequest()
+	{
+		return FProjectilePoolRequest(true, false, ECollisionEnabled::QueryOnly, 0.f, FVector::ZeroVector, FVector::ForwardVector);
+	}
+
+	/* The frames or kernel steps timed by the cases that step the simulation, a hundredth of the iterations */
+	static int32 GetNumSteps(const FProjectileManagerBenchmarkSettings& InSettings)
+	{
+		return FMath::Max(InSettings.Iterations / 100, 1);
+	}
+
+	/* The live counts the cases that tick the whole world measure at, every actor ticking makes larger pools impractical */
+	static const int32 WorldTickLiveCounts[] = { 1000, 5000, 20000 };
+
+	/* The world frames timed, capped as a frame of 20k actors is slow */
+	static int32 GetNumWorldFrames(const FProjectileManagerBenchmarkSettings& InSettings)
+	{
+		return FMath::Min(GetNumSteps(InSettings), 60);
+	}
+
+	/* Nanoseconds per call of a timed loop */
+	static double ToNanosecondsPerCall(double InSeconds, int32 InCalls)
+	{
+		return InCalls > 0 ? InSeconds * 1.0e9 / InCalls : 0.0;
+	}
+
+	/*	Pulls projectiles and holds them. 
+		@param: InManager: The manager to pull from.
+		@param: InNumToHold: The number to pull.
+		@param: OutHeld: The handles of the held projectiles.
+		@param: bInMoving: Spread them out on a grid and fire them, instead of leaving them where they are put.
+	*/
+	static void Hold_Projectiles(AProjectileManagerBase* InManager, int32 InNumToHold, TArray<FProjectileHandle>& OutHeld, bool bInMoving = false)
+	{
+		FProjectilePoolRequest PullRequest = MakePullRequest();
+		OutHeld.Reserve(OutHeld.Num() + InNumToHold);
+
+		const int32 GridSide = FMath::Max(FMath::CeilToInt(FMath::Sqrt(float(InNumToHold))), 1);
+		FRandomStream Stream(InNumToHold);
+
+		for (int32 i = 0; i < InNumToHold; i++)
+		{
+			if (bInMoving)
+			{
+				// far enough apart that they never touch each other while they are measured. 
+				PullRequest = FProjectilePoolRequest(true, false, ECollisionEnabled::QueryOnly, 2000.f, FVector((i % GridSide) * 500.f, (i / GridSide) * 500.f, 1000.f), FVector(Stream.FRandRange(-1.f, 1.f), Stream.FRandRange(-1.f, 1.f), 0.f).GetSafeNormal(SMALL_NUMBER, FVector::ForwardVector));
+			}
+
+			FProjectileHandle Handle;
+			AManagedProjectileBase* Projectile = nullptr;
+			if (InManager->Request_GetProjectileHandleFromManager(Handle, Projectile, PullRequest)) OutHeld.Add(Handle);
+		}
+	}
+
+	/*	Times the whole world tick over a run of frames, after one untimed frame. 
+		@param: InWorld: The world to tick.
+		@param: InNumFrames: The frames timed.
+		@returns: the average milliseconds of a frame.
+	*/
+	static double Measure_WorldTicks(FProjectileManagerTransientWorld& InWorld, int32 InNumFrames)
+	{
+		InWorld.Tick(1.f / 60.f);
+
+		double TotalMilliseconds = 0.0;
+		for (int32 Frame = 0; Frame < InNumFrames; Frame++) TotalMilliseconds += InWorld.Tick(1.f / 60.f);
+		return InNumFrames > 0 ? TotalMilliseconds / InNumFrames : 0.0;
+	}
+
+	/* Returns every held projectile */
+	static void Release_Projectiles(AProjectileManagerBase* InManager, TArray<FProjectileHandle>& InOutHeld)
+	{
+		for (const FProjectileHandle& Handle : InOutHeld) InManager->Request_ReturnProjectileHandleToManager(Handle);
+		InOutHeld.Reset();
+	}
+
+	/*	Times pairs of an acquire and a return through the manager. 
+		@param: InManager: The manager to pull from.
+		@param: InIterations: The pairs timed.
+		@returns: the seconds the pairs took.
+	*/
+	static double Measure_AcquireReturn(AProjectileManagerBase* InManager, int32 InIterations)
+	{
+		FProjectilePoolRequest PullRequest = MakePullRequest();
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < InIterations; i++)
+		{
+			FProjectileHandle Handle;
+			AManagedProjectileBase* Projectile = nullptr;
+			if (InManager->Request_GetProjectileHandleFromManager(Handle, Projectile, PullRequest)) InManager->Request_ReturnProjectileHandleToManager(Handle);
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	}
+
+	/*	Measures one occupancy of a manager, the held projectiles are returned before it ends. 
+		@param: InManager: The manager of the pool size being measured.
+		@param: InPoolSize: The pool size.
+		@param: InOccupancy: The fraction of the pool held in use.
+		@param: InIterations: The calls timed per measurement.
+		@returns: the results of the occupancy.
+	*/
+	static TSharedRef<FJsonObject> Measure_Occupancy(AProjectileManagerBase* InManager, int32 InPoolSize, float InOccupancy, int32 InIterations)
+	{
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		FProjectilePoolRequest PullRequest = MakePullRequest();
+		const FProjectilePoolRequest ReturnRequest = InManager->RetrieveReturnSettings.ReturnProjectileRequest;
+
+		// hold the occupancy, always leaving one free so the cycles never grow the pool. 
+		TArray<FProjectileHandle> Held;
+		Hold_Projectiles(InManager, FMath::Clamp(FMath::RoundToInt(InPoolSize * InOccupancy), 0, InPoolSize - 1), Held);
+
+		Result->SetNumberField(TEXT("occupancy"), InOccupancy);
+		Result->SetNumberField(TEXT("in_use"), InManager->GetInUseCount());
+
+		// acquire and return throughput. 
+		const double CycleSeconds = Measure_AcquireReturn(InManager, InIterations);
+
+		Result->SetNumberField(TEXT("acquire_return_ns"), ToNanosecondsPerCall(CycleSeconds, InIterations));
+		Result->SetNumberField(TEXT("acquire_return_per_second"), CycleSeconds > 0.0 ? InIterations / CycleSeconds : 0.0);
+
+		// the pool request a pull and a return apply, alternating so every call changes the state. 
+		FProjectileHandle UpdateHandle;
+		AManagedProjectileBase* UpdateProjectile = nullptr;
+		if (InManager->Request_GetProjectileHandleFromManager(UpdateHandle, UpdateProjectile, PullRequest) && UpdateProjectile)
+		{
+			const double UpdateStartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < InIterations; i++)
+			{
+				UpdateProjectile->Request_UpdateFromPool((i & 1) ? PullRequest : ReturnRequest);
+			}
+			Result->SetNumberField(TEXT("update_from_pool_ns"), ToNanosecondsPerCall(FPlatformTime::Seconds() - UpdateStartTime, InIterations));
+
+			UpdateProjectile->Request_UpdateFromPool(PullRequest);
+			InManager->Request_ReturnProjectileHandleToManager(UpdateHandle);
+		}
+
+		// grow by a tenth and shrink back, the shrink has to step around the held projectiles. 
+		int32 GrowSize = InPoolSize + FMath::Max(InPoolSize / 10, 1);
+		double StartTime = FPlatformTime::Seconds();
+		InManager->Request_ResizeProjectilePool(GrowSize);
+		Result->SetNumberField(TEXT("grow_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		int32 ShrinkSize = InPoolSize;
+		StartTime = FPlatformTime::Seconds();
+		InManager->Request_ResizeProjectilePool(ShrinkSize);
+		Result->SetNumberField(TEXT("shrink_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		Release_Projectiles(InManager, Held);
+		return Result;
+	}
+
+	/* A plain actor pool of one size, with nothing growing or shrinking it between measurements */
+	static void Configure_PlainPool(AProjectileManagerBase* InManager, int32 InPoolSize)
+	{
+		InManager->InitSettings.ProjectileClassToUse = AManagedProjectileBase::StaticClass();
+		InManager->InitSettings.StartingPoolSize = InPoolSize;
+		InManager->InitSettings.CreationBudgetMilliseconds = 0.f;
+		InManager->AutoscaleSettings.bEnableAutoscaling = false;
+		InManager->AutoscaleSettings.bGrowOnExhaustion = false;
+	}
+
+	/* An actorless data pool of one size, with nothing growing it or sweeping its projectiles */
+	static void Configure_DataPool(AProjectileManagerBase* InManager, int32 InPoolSize)
+	{
+		Configure_PlainPool(InManager, InPoolSize);
+		InManager->InitSettings.PoolMode = EProjectilePoolMode::DataSimulation;
+	}
+
+	/*	Fires a fan of actorless projectiles that stay in the air for the whole case. 
+		@param: InManager: The data mode manager to fire from.
+		@param: InNumToFire: The number to fire.
+		@returns: the number fired.
+	*/
+	static int32 Fire_SimulatedProjectiles(AProjectileManagerBase* InManager, int32 InNumToFire)
+	{
+		FRandomStream Stream(InNumToFire);
+		int32 NumFired = 0;
+
+		for (int32 i = 0; i < InNumToFire; i++)
+		{
+			// up and outward, so nothing falls under the kill z while it is measured. 
+			const FVector Direction = FVector(Stream.FRandRange(-1.f, 1.f), Stream.FRandRange(-1.f, 1.f), Stream.FRandRange(0.5f, 1.f)).GetSafeNormal();
+			FProjectileHandle Handle;
+			if (InManager->Request_FireSimulatedProjectile(Handle, FProjectilePoolRequest(true, false, ECollisionEnabled::NoCollision, 3000.f, FVector::ZeroVector, Direction))) NumFired++;
+		}
+
+		return NumFired;
+	}
+
+	/*	Creates a manager of one pool size and measures every occupancy. 
+		@param: InWorld: The transient world.
+		@param: InPoolSize: The pool size.
+		@param: InSettings: The occupancies and iterations.
+		@returns: the results of the pool size, null if the manager could not be spawned.
+	*/
+	static TSharedPtr<FJsonObject> Measure_PoolSize(FProjectileManagerTransientWorld& InWorld, int32 InPoolSize, const FProjectileManagerBenchmarkSettings& InSettings)
+	{
+		// begin play spawns the whole pool. 
+		const double StartTime = FPlatformTime::Seconds();
+		AProjectileManagerBase* Manager = InWorld.SpawnManager([InPoolSize](AProjectileManagerBase* InManager) { Configure_PlainPool(InManager, InPoolSize); });
+		const double CreateSeconds = FPlatformTime::Seconds() - StartTime;
+		if (!Manager) return nullptr;
+
+		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("pool_size"), InPoolSize);
+		Result->SetNumberField(TEXT("create_ms"), CreateSeconds * 1000.0);
+
+		TArray<TSharedPtr<FJsonValue>> Occupancies;
+		for (float Occupancy : InSettings.Occupancies)
+		{
+			Occupancies.Add(MakeShared<FJsonValueObject>(Measure_Occupancy(Manager, InPoolSize, FMath::Clamp(Occupancy, 0.f, 1.f), InSettings.Iterations)));
+		}
+		Result->SetArrayField(TEXT("occupancies"), Occupancies);
+
+		Manager->Destroy();
+		return Result;
+	}
+
+	/*	Measures one policy of the templated pool on its own, no actors or world involved. 
+		A random held item is released before every acquire so the free slot strategy decides 
+		which slot comes back. 
+		@param: InPolicyName: The name the results are written under.
+		@param: InPoolSize: The pool size.
+		@param: InOccupancy: The fraction of the pool held in use.
+		@param: InIterations: The calls timed per measurement.
+		@returns: the results of the policy.
+	*/
+	template<typename TPolicy>
+	static TSharedPtr<FJsonValue> Measure_PoolCore(const TCHAR* InPolicyName, int32 InPoolSize, float InOccupancy, int32 InIterations)
+	{
+		typedef TProjectilePool<int32, TPolicy> FPool;
+		FPool Pool(InPoolSize);
+		FRandomStream Stream(InPoolSize);
+
+		// at least one held so there is always something to release. 
+		const int32 NumToHold = FMath::Clamp(FMath::RoundToInt(InPoolSize * InOccupancy), 1, InPoolSize - 1);
+		TArray<typename FPool::FHandle> Held;
+		Held.Reserve(NumToHold);
+		for (int32 i = 0; i < NumToHold; i++) Held.Add(Pool.Acquire(i));
+
+		// release and acquire pairs. 
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < InIterations; i++)
+		{
+			const int32 HeldIndex = Stream.RandHelper(Held.Num());
+			Pool.Release(Held[HeldIndex]);
+			Held[HeldIndex] = Pool.Acquire(i);
+		}
+		const double CycleSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// resolves, a quarter of them stale. 
+		int32 NumResolved = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < InIterations; i++)
+		{
+			typename FPool::FHandle Handle = Held[i % Held.Num()];
+			if ((i & 3) == 0) Handle.Generation++;
+			if (Pool.Resolve(Handle)) NumResolved++;
+		}
+		const double ResolveSeconds = FPlatformTime::Seconds() - StartTime;
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("policy"), InPolicyName);
+		Result->SetNumberField(TEXT("pool_size"), InPoolSize);
+		Result->SetNumberField(TEXT("occupancy"), InOccupancy);
+		Result->SetNumberField(TEXT("release_acquire_ns"), ToNanosecondsPerCall(CycleSeconds, InIterations));
+		Result->SetNumberField(TEXT("resolve_ns"), ToNanosecondsPerCall(ResolveSeconds, InIterations));
+		Result->SetNumberField(TEXT("resolved"), NumResolved);
+		return MakeShared<FJsonValueObject>(Result);
+	}
+
+	/*	The pool operations case, every pool size in its own manager measured at every occupancy. 
+		Acquire and return throughput, Request_UpdateFromPool cost, and the latency of growing the 
+		pool and shrinking it back. 
+		@param: InSettings: The pool sizes, occupancies and iterations.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_PoolOperations(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		FProjectileManagerTransientWorld World(TEXT("ProjectileManagerBenchmark"));
+		if (!World.IsValid()) return false;
+
+		TArray<TSharedPtr<FJsonValue>> PoolResults;
+		for (int32 PoolSize : InSettings.PoolSizes)
+		{
+			if (PoolSize <= 0) continue;
+
+			if (TSharedPtr<FJsonObject> PoolResult = Measure_PoolSize(World, PoolSize, InSettings))
+			{
+				PoolResults.Add(MakeShared<FJsonValueObject>(PoolResult));
+			}
+		}
+
+		OutResult.SetArrayField(TEXT("results"), PoolResults);
+		return true;
+	}
+
+	/*	The pool core case, every templated pool policy on its own at every pool size and occupancy. 
+		@param: InSettings: The pool sizes, occupancies and iterations.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_PoolCore(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (int32 PoolSize : InSettings.PoolSizes)
+		{
+			if (PoolSize <= 1) continue;
+
+			for (float Occupancy : InSettings.Occupancies)
+			{
+				Occupancy = FMath::Clamp(Occupancy, 0.f, 1.f);
+				Results.Add(Measure_PoolCore<FProjectilePoolDefaultPolicy>(TEXT("stack"), PoolSize, Occupancy, InSettings.Iterations));
+				Results.Add(Measure_PoolCore<FProjectilePoolFifoPolicy>(TEXT("fifo"), PoolSize, Occupancy, InSettings.Iterations));
+				Results.Add(Measure_PoolCore<FProjectilePoolBitsetPolicy>(TEXT("bitset"), PoolSize, Occupancy, InSettings.Iterations));
+				Results.Add(Measure_PoolCore<FProjectilePoolThreadSafePolicy>(TEXT("stack_locked"), PoolSize, Occupancy, InSettings.Iterations));
+				Results.Add(Measure_PoolCore<FProjectilePoolLockFreePolicy>(TEXT("stack_lock_free"), PoolSize, Occupancy, InSettings.Iterations));
+			}
+		}
+
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/*	The search the pool made before it had a free list, the first entry not in use from the 
+		front. Only kept so the free list has something to be measured against. 
+		@param: InInUse: The in use state of every entry.
+		@returns: the first free entry, -1 if there is none.
+	*/
+	static int32 FindFirstFree_LinearScan(const TArray<bool>& InInUse)
+	{
+		for (int32 i = 0; i < InInUse.Num(); i++)
+		{
+			if (!InInUse[i]) return i;
+		}
+
+		return INDEX_NONE;
+	}
+
+	/*	The free list case, the free slot stack and the whole manager acquire against the linear 
+		scan it replaced at 10, 50 and 99 percent occupancy. The old pool handed out from the front, 
+		so the held entries are packed there and the scan walks all of them on every acquire. 
+		@param: InSettings: The pool sizes and iterations, the occupancies are fixed.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_FreeList(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		FProjectileManagerTransientWorld World(TEXT("ProjectileManagerBenchmarkFreeList"));
+		if (!World.IsValid()) return false;
+
+		const float Occupancies[] = { 0.1f, 0.5f, 0.99f };
+		volatile int32 FoundSink = 0;
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (int32 PoolSize : InSettings.PoolSizes)
+		{
+			if (PoolSize <= 1) continue;
+
+			AProjectileManagerBase* Manager = World.SpawnManager([PoolSize](AProjectileManagerBase* InManager) { Configure_PlainPool(InManager, PoolSize); });
+			if (!Manager) return false;
+
+			for (float Occupancy : Occupancies)
+			{
+				const int32 NumToHold = FMath::Clamp(FMath::RoundToInt(PoolSize * Occupancy), 0, PoolSize - 1);
+
+				// the old scan, an acquire finds the first free entry and the return frees it again. 
+				TArray<bool> InUse;
+				InUse.Init(false, PoolSize);
+				for (int32 i = 0; i < NumToHold; i++) InUse[i] = true;
+
+				double StartTime = FPlatformTime::Seconds();
+				for (int32 i = 0; i < InSettings.Iterations; i++)
+				{
+					const int32 Found = FindFirstFree_LinearScan(InUse);
+					InUse[Found] = true;
+					InUse[Found] = false;
+					FoundSink = Found;
+				}
+				const double ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+				// the free list on its own, the held slots already popped. 
+				FProjectileFreeSlotStack FreeSlots;
+				FreeSlots.Reset(PoolSize);
+				for (int32 Slot = PoolSize - 1; Slot >= NumToHold; Slot--) FreeSlots.Push(Slot);
+
+				StartTime = FPlatformTime::Seconds();
+				for (int32 i = 0; i < InSettings.Iterations; i++)
+				{
+					const int32 Found = FreeSlots.Pop();
+					FreeSlots.Push(Found);
+					FoundSink = Found;
+				}
+				const double FreeListSeconds = FPlatformTime::Seconds() - StartTime;
+
+				// and the whole manager acquire and return on top of it. 
+				TArray<FProjectileHandle> Held;
+				Hold_Projectiles(Manager, NumToHold, Held);
+				const double ManagerSeconds = Measure_AcquireReturn(Manager, InSettings.Iterations);
+				Release_Projectiles(Manager, Held);
+
+				TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+				Result->SetNumberField(TEXT("pool_size"), PoolSize);
+				Result->SetNumberField(TEXT("occupancy"), Occupancy);
+				Result->SetNumberField(TEXT("linear_scan_ns"), ToNanosecondsPerCall(ScanSeconds, InSettings.Iterations));
+				Result->SetNumberField(TEXT("free_list_ns"), ToNanosecondsPerCall(FreeListSeconds, InSettings.Iterations));
+				Result->SetNumberField(TEXT("manager_acquire_return_ns"), ToNanosecondsPerCall(ManagerSeconds, InSettings.Iterations));
+				Result->SetNumberField(TEXT("free_list_speedup"), FreeListSeconds > 0.0 ? ScanSeconds / FreeListSeconds : 0.0);
+				Results.Add(MakeShared<FJsonValueObject>(Result));
+			}
+
+			Manager->Destroy();
+		}
+
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/*	Times the manager tick alone over a run of frames. 
+		@param: InManager: The manager to tick.
+		@param: InNumFrames: The frames timed.
+		@param: OutMinFrameSeconds: The fastest frame.
+		@param: OutMaxFrameSeconds: The slowest frame.
+		@returns: the seconds every frame took together.
+	*/
+	static double Measure_ManagerTicks(AProjectileManagerBase* InManager, int32 InNumFrames, double& OutMinFrameSeconds, double& OutMaxFrameSeconds)
+	{
+		OutMinFrameSeconds = MAX_dbl;
+		OutMaxFrameSeconds = 0.0;
+		double TotalSeconds = 0.0;
+
+		for (int32 Frame = 0; Frame < InNumFrames; Frame++)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			InManager->Tick(1.f / 60.f);
+			const double FrameSeconds = FPlatformTime::Seconds() - StartTime;
+
+			OutMinFrameSeconds = FMath::Min(OutMinFrameSeconds, FrameSeconds);
+			OutMaxFrameSeconds = FMath::Max(OutMaxFrameSeconds, FrameSeconds);
+			TotalSeconds += FrameSeconds;
+		}
+
+		return TotalSeconds;
+	}
+
+	/*	The data mode case, a data mode manager per pool size with the whole pool live, the default 
+		100k being the headless target. Times firing the pool and the manager tick that simulates it, 
+		no world tick and no actors involved. 
+		@param: InSettings: The pool sizes and the frames timed.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_DataMode(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		FProjectileManagerTransientWorld World(TEXT("ProjectileManagerBenchmarkDataMode"));
+		if (!World.IsValid()) return false;
+
+		const int32 NumFrames = GetNumSteps(InSettings);
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (int32 PoolSize : InSettings.PoolSizes)
+		{
+			if (PoolSize <= 0) continue;
+
+			AProjectileManagerBase* Manager = World.SpawnManager([PoolSize](AProjectileManagerBase* InManager) { Configure_DataPool(InManager, PoolSize); });
+			if (!Manager) return false;
+
+			const double StartTime = FPlatformTime::Seconds();
+			const int32 NumLive = Fire_SimulatedProjectiles(Manager, PoolSize);
+			const double FireSeconds = FPlatformTime::Seconds() - StartTime;
+
+			double MinFrameSeconds, MaxFrameSeconds;
+			const double TotalSeconds = Measure_ManagerTicks(Manager, NumFrames, MinFrameSeconds, MaxFrameSeconds);
+
+			TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetNumberField(TEXT("pool_size"), PoolSize);
+			Result->SetNumberField(TEXT("live"), NumLive);
+			Result->SetNumberField(TEXT("still_live"), Manager->GetSimulatedProjectileCount());
+			Result->SetNumberField(TEXT("frames"), NumFrames);
+			Result->SetNumberField(TEXT("fire_ns"), ToNanosecondsPerCall(FireSeconds, NumLive));
+			Result->SetNumberField(TEXT("tick_average_ms"), TotalSeconds * 1000.0 / NumFrames);
+			Result->SetNumberField(TEXT("tick_min_ms"), MinFrameSeconds * 1000.0);
+			Result->SetNumberField(TEXT("tick_max_ms"), MaxFrameSeconds * 1000.0);
+			Result->SetNumberField(TEXT("projectiles_per_ms"), TotalSeconds > 0.0 ? double(NumLive) * NumFrames / (TotalSeconds * 1000.0) : 0.0);
+			Results.Add(MakeShared<FJsonValueObject>(Result));
+
+			Manager->Destroy();
+		}
+
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/*	The collision modes case, the world tick with every live count of moving projectiles in 
+		flight, colliding through their own sphere components, then through the managers async 
+		sweeps. The world tick holds the physics scene work either mode costs. 
+		@param: InSettings: The frames timed, the live counts are fixed.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_CollisionModes(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		FProjectileManagerTransientWorld World(TEXT("ProjectileManagerBenchmarkCollisionModes"));
+		if (!World.IsValid()) return false;
+
+		const int32 NumFrames = GetNumWorldFrames(InSettings);
+		const EProjectileCollisionMode CollisionModes[] = { EProjectileCollisionMode::ComponentOverlap, EProjectileCollisionMode::AsyncSweep };
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (int32 NumLive : WorldTickLiveCounts)
+		{
+			for (EProjectileCollisionMode CollisionMode : CollisionModes)
+			{
+				AProjectileManagerBase* Manager = World.SpawnManager([NumLive, CollisionMode](AProjectileManagerBase* InManager)
+				{
+					Configure_PlainPool(InManager, NumLive);
+					InManager->CollisionSettings.CollisionMode = CollisionMode;
+				});
+				if (!Manager) return false;
+
+				TArray<FProjectileHandle> Held;
+				Hold_Projectiles(Manager, NumLive, Held, true);
+				const double TickMilliseconds = Measure_WorldTicks(World, NumFrames);
+
+				TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+				Result->SetNumberField(TEXT("live"), Held.Num());
+				Result->SetStringField(TEXT("collision_mode"), CollisionMode == EProjectileCollisionMode::AsyncSweep ? TEXT("async_sweep") : TEXT("component_overlap"));
+				Result->SetNumberField(TEXT("world_tick_average_ms"), TickMilliseconds);
+				Results.Add(MakeShared<FJsonValueObject>(Result));
+
+				Release_Projectiles(Manager, Held);
+				Manager->Destroy();
+			}
+		}
+
+		OutResult.SetNumberField(TEXT("frames"), NumFrames);
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/*	The tick modes case, the world tick with every live count of moving projectiles in flight, 
+		each actor and its movement component ticking itself, then the manager moving them all in 
+		one batched tick. 
+		@param: InSettings: The frames timed, the live counts are fixed.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_TickModes(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		FProjectileManagerTransientWorld World(TEXT("ProjectileManagerBenchmarkTickModes"));
+		if (!World.IsValid()) return false;
+
+		const int32 NumFrames = GetNumWorldFrames(InSettings);
+		const EProjectileTickMode TickModes[] = { EProjectileTickMode::PerActor, EProjectileTickMode::ManagerBatched };
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (int32 NumLive : WorldTickLiveCounts)
+		{
+			double PerActorMilliseconds = 0.0;
+
+			for (EProjectileTickMode TickMode : TickModes)
+			{
+				AProjectileManagerBase* Manager = World.SpawnManager([NumLive, TickMode](AProjectileManagerBase* InManager)
+				{
+					Configure_PlainPool(InManager, NumLive);
+					InManager->InitSettings.TickMode = TickMode;
+				});
+				if (!Manager) return false;
+
+				TArray<FProjectileHandle> Held;
+				Hold_Projectiles(Manager, NumLive, Held, true);
+				const double TickMilliseconds = Measure_WorldTicks(World, NumFrames);
+				if (TickMode == EProjectileTickMode::PerActor) PerActorMilliseconds = TickMilliseconds;
+
+				TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+				Result->SetNumberField(TEXT("live"), Held.Num());
+				Result->SetStringField(TEXT("tick_mode"), TickMode == EProjectileTickMode::ManagerBatched ? TEXT("manager_batched") : TEXT("per_actor"));
+				Result->SetNumberField(TEXT("world_tick_average_ms"), TickMilliseconds);
+				Result->SetNumberField(TEXT("speedup_vs_per_actor"), TickMilliseconds > 0.0 ? PerActorMilliseconds / TickMilliseconds : 0.0);
+				Results.Add(MakeShared<FJsonValueObject>(Result));
+
+				Release_Projectiles(Manager, Held);
+				Manager->Destroy();
+			}
+		}
+
+		OutResult.SetNumberField(TEXT("frames"), NumFrames);
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/* Is any component of the projectile waiting on a render state update? */
+	static bool IsRenderStateDirty(AManagedProjectileBase* InProjectile)
+	{
+		TInlineComponentArray<UActorComponent*> Components(InProjectile);
+		for (UActorComponent* Component : Components)
+		{
+			if (Component && Component->IsRenderStateDirty()) return true;
+		}
+
+		return false;
+	}
+
+	/* Reads the pool state setters every projectile has called, they are only counted in builds with the automation tests */
+	static void Count_PoolStateSets(int32& OutCollisionSets, int32& OutTickSets, int32& OutHiddenSets)
+	{
+#if WITH_DEV_AUTOMATION_TESTS
+		OutCollisionSets = FProjectilePoolStateSetCounts::NumCollisionSets;
+		OutTickSets = FProjectilePoolStateSetCounts::NumTickSets;
+		OutHiddenSets = FProjectilePoolStateSetCounts::NumHiddenSets;
+#else
+		OutCollisionSets = OutTickSets = OutHiddenSets = 0;
+#endif
+	}
+
+	/*	Times pull and return pairs, counting the pool state setters they call and the render 
+		state updates they cause. The render state is flushed after every call so each update is 
+		counted once. 
+		@param: InWorld: The world of the manager.
+		@param: InManager: The manager to pull from.
+		@param: InNumCycles: The pairs timed.
+		@param: bInInvalidate: Forget the applied state before every call, as before the cache.
+		@returns: the results of the variant.
+	*/
+	static TSharedRef<FJsonObject> Measure_PoolStateCycles(FProjectileManagerTransientWorld& InWorld, AProjectileManagerBase* InManager, int32 InNumCycles, bool bInInvalidate)
+	{
+		UWorld* const World = InWorld.GetWorld();
+		FProjectilePoolRequest PullRequest = MakePullRequest();
+		int32 NumRenderStateDirties = 0;
+		double UpdateSeconds = 0.0;
+
+		auto CountRenderState = [World, &NumRenderStateDirties](AManagedProjectileBase* InProjectile)
+		{
+			if (IsRenderStateDirty(InProjectile)) NumRenderStateDirties++;
+			World->SendAllEndOfFrameUpdates();
+		};
+
+		// a projectile is only known once it is pulled, so every one starts forgotten and is forgotten again after its return. 
+		if (bInInvalidate)
+		{
+			for (TActorIterator<AManagedProjectileBase> It(World); It; ++It) It->InvalidateAppliedPoolState();
+		}
+
+		int32 CollisionSetsBefore, TickSetsBefore, HiddenSetsBefore;
+		Count_PoolStateSets(CollisionSetsBefore, TickSetsBefore, HiddenSetsBefore);
+
+		for (int32 Cycle = 0; Cycle < InNumCycles; Cycle++)
+		{
+			FProjectileHandle Handle;
+			AManagedProjectileBase* Projectile = nullptr;
+
+			double StartTime = FPlatformTime::Seconds();
+			if (!InManager->Request_GetProjectileHandleFromManager(Handle, Projectile, PullRequest) || !Projectile) break;
+			UpdateSeconds += FPlatformTime::Seconds() - StartTime;
+			CountRenderState(Projectile);
+
+			if (bInInvalidate) Projectile->InvalidateAppliedPoolState();
+
+			StartTime = FPlatformTime::Seconds();
+			InManager->Request_ReturnProjectileHandleToManager(Handle);
+			UpdateSeconds += FPlatformTime::Seconds() - StartTime;
+			CountRenderState(Projectile);
+
+			if (bInInvalidate) Projectile->InvalidateAppliedPoolState();
+		}
+
+		int32 CollisionSetsAfter, TickSetsAfter, HiddenSetsAfter;
+		Count_PoolStateSets(CollisionSetsAfter, TickSetsAfter, HiddenSetsAfter);
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("variant"), bInInvalidate ? TEXT("invalidated") : TEXT("cached"));
+		Result->SetNumberField(TEXT("cycles"), InNumCycles);
+		Result->SetNumberField(TEXT("pull_return_ns"), ToNanosecondsPerCall(UpdateSeconds, InNumCycles));
+#if WITH_DEV_AUTOMATION_TESTS
+		Result->SetNumberField(TEXT("collision_sets"), CollisionSetsAfter - CollisionSetsBefore);
+		Result->SetNumberField(TEXT("tick_sets"), TickSetsAfter - TickSetsBefore);
+		Result->SetNumberField(TEXT("hidden_sets"), HiddenSetsAfter - HiddenSetsBefore);
+#endif
+		Result->SetNumberField(TEXT("render_state_dirties"), NumRenderStateDirties);
+		return Result;
+	}
+
+	/*	The pool state case, 1k pull and return pairs with the applied state cache, then with the 
+		state forgotten before every call as the projectile set it before the cache. Counts the 
+		collision, tick and visibility setters the pairs call, each collision set being a possible 
+		physics state recreation, and the render state updates the pairs cause. The engine setters 
+		skip a value they already have too, so the cache mostly saves the calls and the checks. 
+		@param: InSettings: Unused, the pair count is fixed.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_PoolStateChanges(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		FProjectileManagerTransientWorld World(TEXT("ProjectileManagerBenchmarkPoolStateChanges"));
+		if (!World.IsValid()) return false;
+
+		const int32 NumCycles = 1000;
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (bool bInvalidate : { false, true })
+		{
+			AProjectileManagerBase* Manager = World.SpawnManager([NumCycles](AProjectileManagerBase* InManager) { Configure_PlainPool(InManager, NumCycles); });
+			if (!Manager) return false;
+
+			Results.Add(MakeShared<FJsonValueObject>(Measure_PoolStateCycles(World, Manager, NumCycles, bInvalidate)));
+			Manager->Destroy();
+		}
+
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/* Counts the primitive components of pooled projectiles still in the scenes */
+	static int32 Count_RegisteredPrimitives(UWorld* InWorld)
+	{
+		int32 NumRegistered = 0;
+		for (TActorIterator<AManagedProjectileBase> It(InWorld); It; ++It)
+		{
+			TInlineComponentArray<UPrimitiveComponent*> Primitives(*It);
+			for (UPrimitiveComponent* Primitive : Primitives)
+			{
+				if (Primitive && Primitive->IsRegistered()) NumRegistered++;
+			}
+		}
+
+		return NumRegistered;
+	}
+
+	/*	The parking case, 10k projectiles pulled and returned so they all wait in the pool, with 
+		the world tick timed while they are parked by teleport and then parked unregistered. The 
+		pull and return pairs are timed as well, as unregistered projectiles register again on 
+		every pull. 
+		@param: InSettings: The frames and the pairs timed.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_Parking(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		FProjectileManagerTransientWorld World(TEXT("ProjectileManagerBenchmarkParking"));
+		if (!World.IsValid()) return false;
+
+		const int32 NumParked = 10000;
+		const int32 NumFrames = GetNumWorldFrames(InSettings);
+		const int32 NumSteps = GetNumSteps(InSettings);
+		const EProjectileParkingMode ParkingModes[] = { EProjectileParkingMode::Teleport, EProjectileParkingMode::Unregister };
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		double TeleportMilliseconds = 0.0;
+
+		for (EProjectileParkingMode ParkingMode : ParkingModes)
+		{
+			AProjectileManagerBase* Manager = World.SpawnManager([NumParked, ParkingMode](AProjectileManagerBase* InManager)
+			{
+				Configure_PlainPool(InManager, NumParked);
+				InManager->RetrieveReturnSettings.ParkingMode = ParkingMode;
+			});
+			if (!Manager) return false;
+
+			// every projectile goes through a return, so none is left where creation put it. 
+			TArray<FProjectileHandle> Held;
+			Hold_Projectiles(Manager, NumParked, Held, true);
+			const int32 NumReturned = Held.Num();
+			Release_Projectiles(Manager, Held);
+
+			const double TickMilliseconds = Measure_WorldTicks(World, NumFrames);
+			if (ParkingMode == EProjectileParkingMode::Teleport) TeleportMilliseconds = TickMilliseconds;
+
+			TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetNumberField(TEXT("parked"), NumReturned);
+			Result->SetStringField(TEXT("parking_mode"), ParkingMode == EProjectileParkingMode::Unregister ? TEXT("unregister") : TEXT("teleport"));
+			Result->SetNumberField(TEXT("registered_primitives"), Count_RegisteredPrimitives(World.GetWorld()));
+			Result->SetNumberField(TEXT("world_tick_average_ms"), TickMilliseconds);
+			Result->SetNumberField(TEXT("speedup_vs_teleport"), TickMilliseconds > 0.0 ? TeleportMilliseconds / TickMilliseconds : 0.0);
+			Result->SetNumberField(TEXT("pull_return_ns"), ToNanosecondsPerCall(Measure_AcquireReturn(Manager, NumSteps), NumSteps));
+			Results.Add(MakeShared<FJsonValueObject>(Result));
+
+			Manager->Destroy();
+		}
+
+		OutResult.SetNumberField(TEXT("frames"), NumFrames);
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/*	The render modes case, the world tick with 1k, 5k and 20k moving projectiles drawn by their 
+		own components and then by one instanced mesh. The instanced runs read the instance count 
+		and the instance update time from the pool telemetry of the last frame. Under -nullrhi only 
+		the game thread side is timed, the render thread does no drawing. 
+		@param: InSettings: The frames timed.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_RenderModes(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		UStaticMesh* InstanceMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+		if (!InstanceMesh)
+		{
+			UE_LOG(LogClass, Error, TEXT("The render modes benchmark case could not load its instance mesh"));
+			return false;
+		}
+
+		FProjectileManagerTransientWorld World(TEXT("ProjectileManagerBenchmarkRenderModes"));
+		if (!World.IsValid()) return false;
+
+		const int32 NumFrames = GetNumWorldFrames(InSettings);
+		const EProjectileRenderMode RenderModes[] = { EProjectileRenderMode::PerActor, EProjectileRenderMode::InstancedMesh };
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (int32 NumLive : WorldTickLiveCounts)
+		{
+			double PerActorMilliseconds = 0.0;
+
+			for (EProjectileRenderMode RenderMode : RenderModes)
+			{
+				AProjectileManagerBase* Manager = World.SpawnManager([NumLive, RenderMode, InstanceMesh](AProjectileManagerBase* InManager)
+				{
+					Configure_PlainPool(InManager, NumLive);
+					InManager->InitSettings.RenderMode = RenderMode;
+					InManager->InitSettings.InstanceMesh = InstanceMesh;
+				});
+				if (!Manager) return false;
+
+				TArray<FProjectileHandle> Held;
+				Hold_Projectiles(Manager, NumLive, Held, true);
+				const double TickMilliseconds = Measure_WorldTicks(World, NumFrames);
+				if (RenderMode == EProjectileRenderMode::PerActor) PerActorMilliseconds = TickMilliseconds;
+
+				const FProjectilePoolTelemetry Telemetry = Manager->GetPoolTelemetry(0);
+
+				TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+				Result->SetNumberField(TEXT("live"), Held.Num());
+				Result->SetStringField(TEXT("render_mode"), RenderMode == EProjectileRenderMode::InstancedMesh ? TEXT("instanced_mesh") : TEXT("per_actor"));
+				Result->SetNumberField(TEXT("world_tick_average_ms"), TickMilliseconds);
+				Result->SetNumberField(TEXT("speedup_vs_per_actor"), TickMilliseconds > 0.0 ? PerActorMilliseconds / TickMilliseconds : 0.0);
+				Result->SetNumberField(TEXT("rendered_instances"), Telemetry.RenderedInstances);
+				Result->SetNumberField(TEXT("instance_update_ms"), Telemetry.InstanceUpdateMilliseconds);
+				Results.Add(MakeShared<FJsonValueObject>(Result));
+
+				Release_Projectiles(Manager, Held);
+				Manager->Destroy();
+			}
+		}
+
+		OutResult.SetNumberField(TEXT("frames"), NumFrames);
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/*	The parallel workers case, the data mode tick of every pool size with the simulation on the 
+		game thread alone, then spread over 1, 2, 4, 8 and 16 task graph workers. The speedup is 
+		against one worker, counts past the machines workers are clamped by the task graph. 
+		@param: InSettings: The pool sizes and the frames timed.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_ParallelWorkers(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		FProjectileManagerTransientWorld World(TEXT("ProjectileManagerBenchmarkParallelWorkers"));
+		if (!World.IsValid()) return false;
+
+		const int32 NumFrames = GetNumSteps(InSettings);
+		const int32 WorkerCounts[] = { 0, 1, 2, 4, 8, 16 };
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (int32 PoolSize : InSettings.PoolSizes)
+		{
+			if (PoolSize <= 0) continue;
+
+			AProjectileManagerBase* Manager = World.SpawnManager([PoolSize](AProjectileManagerBase* InManager) { Configure_DataPool(InManager, PoolSize); });
+			if (!Manager) return false;
+
+			const int32 NumLive = Fire_SimulatedProjectiles(Manager, PoolSize);
+			double OneWorkerSeconds = 0.0;
+
+			for (int32 WorkerCount : WorkerCounts)
+			{
+				// 0 is the serial path, not every worker. 
+				Manager->SimulationSettings.bSimulateInParallel = WorkerCount > 0;
+				Manager->SimulationSettings.MaxParallelWorkers = FMath::Max(WorkerCount, 1);
+
+				// one untimed frame so the chunk results are sized for this worker count. 
+				Manager->Tick(1.f / 60.f);
+
+				double MinFrameSeconds, MaxFrameSeconds;
+				const double TotalSeconds = Measure_ManagerTicks(Manager, NumFrames, MinFrameSeconds, MaxFrameSeconds);
+				if (WorkerCount == 1) OneWorkerSeconds = TotalSeconds;
+
+				TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+				Result->SetNumberField(TEXT("pool_size"), PoolSize);
+				Result->SetNumberField(TEXT("live"), NumLive);
+				Result->SetNumberField(TEXT("workers"), WorkerCount);
+				Result->SetNumberField(TEXT("tick_average_ms"), TotalSeconds * 1000.0 / NumFrames);
+				Result->SetNumberField(TEXT("tick_min_ms"), MinFrameSeconds * 1000.0);
+				Result->SetNumberField(TEXT("speedup_vs_one_worker"), WorkerCount > 0 && OneWorkerSeconds > 0.0 && TotalSeconds > 0.0 ? OneWorkerSeconds / TotalSeconds : 0.0);
+				Results.Add(MakeShared<FJsonValueObject>(Result));
+			}
+
+			Manager->Destroy();
+		}
+
+		OutResult.SetNumberField(TEXT("task_graph_workers"), FTaskGraphInterface::Get().GetNumWorkerThreads());
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/*	Times one path of the ballistic kernel over a whole data set. 
+		@param: InData: The data set, advanced by every step.
+		@param: InNumSteps: The steps timed.
+		@param: InIntegrate: The integration path.
+		@param: InComputeOrientations: The orientation path.
+		@param: OutIntegrateSeconds: The time spent integrating.
+		@param: OutOrientationSeconds: The time spent on orientations.
+	*/
+	typedef void (*FIntegrateFunction)(FProjectileSimulationData&, int32, int32, float, const FProjectileBallisticParams&);
+	typedef void (*FOrientationFunction)(FProjectileSimulationData&, int32, int32);
+
+	static void Measure_KernelPath(FProjectileSimulationData& InData, int32 InNumSteps, FIntegrateFunction InIntegrate, FOrientationFunction InComputeOrientations, double& OutIntegrateSeconds, double& OutOrientationSeconds)
+	{
+		const FProjectileBallisticParams Params(FVector(0.f, 0.f, -980.f), 0.1f, 20000.f);
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Step = 0; Step < InNumSteps; Step++) InIntegrate(InData, 0, InData.Num(), 1.f / 60.f, Params);
+		OutIntegrateSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Step = 0; Step < InNumSteps; Step++) InComputeOrientations(InData, 0, InData.Num());
+		OutOrientationSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	/*	The kernel case, scalar and vectorized throughput of the ballistic kernel in projectiles 
+		per millisecond, for a data set of every pool size. Nothing else runs, no world is needed. 
+		@param: InSettings: The pool sizes and the steps timed.
+		@param: OutResult: The results of the case.
+		@returns: if the case ran.
+	*/
+	static bool Run_Kernel(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult)
+	{
+		const int32 NumSteps = GetNumSteps(InSettings);
+		auto ToProjectilesPerMillisecond = [NumSteps](int32 InNum, double InSeconds) { return InSeconds > 0.0 ? double(InNum) * NumSteps / (InSeconds * 1000.0) : 0.0; };
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		for (int32 PoolSize : InSettings.PoolSizes)
+		{
+			if (PoolSize <= 0) continue;
+
+			// the same fan of projectiles for both paths. 
+			FProjectileSimulationData ScalarData;
+			ScalarData.Initialize(PoolSize);
+			FRandomStream Stream(PoolSize);
+			for (int32 i = 0; i < PoolSize; i++)
+			{
+				FProjectileHandle Handle;
+				ScalarData.Add(FProjectilePoolRequest(true, false, ECollisionEnabled::QueryOnly, Stream.FRandRange(1000.f, 10000.f), Stream.GetUnitVector() * 1000.f, Stream.GetUnitVector()), 0.f, Handle);
+			}
+			FProjectileSimulationData VectorizedData = ScalarData;
+
+			double ScalarIntegrateSeconds, ScalarOrientationSeconds, VectorizedIntegrateSeconds, VectorizedOrientationSeconds;
+			Measure_KernelPath(ScalarData, NumSteps, &FProjectileBallisticKernel::Integrate_Scalar, &FProjectileBallisticKernel::ComputeOrientations_Scalar, ScalarIntegrateSeconds, ScalarOrientationSeconds);
+			Measure_KernelPath(VectorizedData, NumSteps, &FProjectileBallisticKernel::Integrate_Vectorized, &FProjectileBallisticKernel::ComputeOrientations_Vectorized, VectorizedIntegrateSeconds, VectorizedOrientationSeconds);
+
+			TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetNumberField(TEXT("projectiles"), PoolSize);
+			Result->SetNumberField(TEXT("steps"), NumSteps);
+			Result->SetNumberField(TEXT("integrate_scalar_per_ms"), ToProjectilesPerMillisecond(PoolSize, ScalarIntegrateSeconds));
+			Result->SetNumberField(TEXT("integrate_vectorized_per_ms"), ToProjectilesPerMillisecond(PoolSize, VectorizedIntegrateSeconds));
+			Result->SetNumberField(TEXT("integrate_speedup"), VectorizedIntegrateSeconds > 0.0 ? ScalarIntegrateSeconds / VectorizedIntegrateSeconds : 0.0);
+			Result->SetNumberField(TEXT("orientations_scalar_per_ms"), ToProjectilesPerMillisecond(PoolSize, ScalarOrientationSeconds));
+			Result->SetNumberField(TEXT("orientations_vectorized_per_ms"), ToProjectilesPerMillisecond(PoolSize, VectorizedOrientationSeconds));
+			Result->SetNumberField(TEXT("orientations_speedup"), VectorizedOrientationSeconds > 0.0 ? ScalarOrientationSeconds / VectorizedOrientationSeconds : 0.0);
+			Results.Add(MakeShared<FJsonValueObject>(Result));
+		}
+
+		OutResult.SetArrayField(TEXT("results"), Results);
+		return true;
+	}
+
+	/* One named case of the suite, the name is also the last part of its automation test name */
+	typedef bool (*FRunCaseFunction)(const FProjectileManagerBenchmarkSettings& InSettings, FJsonObject& OutResult);
+
+	struct FBenchmarkCase
+	{
+		const TCHAR* Name;
+		FRunCaseFunction RunFunction;
+	};
+
+	static const FBenchmarkCase BenchmarkCases[] =
+	{
+		{ TEXT("PoolOperations"), &Run_PoolOperations },
+		{ TEXT("PoolCore"), &Run_PoolCore },
+		{ TEXT("Kernel"), &Run_Kernel },
+		{ TEXT("FreeList"), &Run_FreeList },
+		{ TEXT("DataMode"), &Run_DataMode },
+		{ TEXT("ParallelWorkers"), &Run_ParallelWorkers },
+		{ TEXT("CollisionModes"), &Run_CollisionModes },
+		{ TEXT("TickModes"), &Run_TickModes },
+		{ TEXT("PoolStateChanges"), &Run_PoolStateChanges },
+		{ TEXT("Parking"), &Run_Parking },
+		{ TEXT("RenderModes"), &Run_RenderModes },
+	};
+
+	/* Finds a case by name, null if there is none */
+	static const FBenchmarkCase* FindCase(const FString& InCaseName)
+	{
+		for (const FBenchmarkCase& Case : BenchmarkCases)
+		{
+			if (InCaseName == Case.Name) return &Case;
+		}
+
+		return nullptr;
+	}
+
+	/* Splits a comma separated list */
+	static void ParseList(const TCHAR* InArgs, const TCHAR* InName, TFunctionRef<void(const FString&)> InAdd)
+	{
+		FString List;
+		if (!FParse::Value(InArgs, InName, List)) return;
+
+		TArray<FString> Values;
+		List.ParseIntoArray(Values, TEXT(","));
+		for (const FString& Value : Values) InAdd(Value);
+	}
+
+	/* The console command, runs the benchmark with the args given and logs where the json went */
+	static void Execute_BenchmarkCommand(const TArray<FString>& InArgs)
+	{
+		const FString Args = FString::Join(InArgs, TEXT(" "));
+		FProjectileManagerBenchmarkSettings Settings;
+
+		TArray<int32> PoolSizes;
+		ParseList(*Args, TEXT("PoolSizes="), [&PoolSizes](const FString& Value) { PoolSizes.Add(FCString::Atoi(*Value)); });
+		if (PoolSizes.Num() > 0) Settings.PoolSizes = PoolSizes;
+
+		TArray<float> Occupancies;
+		ParseList(*Args, TEXT("Occupancies="), [&Occupancies](const FString& Value) { Occupancies.Add(FCString::Atof(*Value)); });
+		if (Occupancies.Num() > 0) Settings.Occupancies = Occupancies;
+
+		ParseList(*Args, TEXT("Cases="), [&Settings](const FString& Value) { Settings.Cases.Add(Value); });
+		FParse::Value(*Args, TEXT("Iterations="), Settings.Iterations);
+		FParse::Value(*Args, TEXT("Output="), Settings.OutputPath);
+
+		FString SavedPath;
+		if (FProjectileManagerBenchmark::RunAndSave(Settings, SavedPath))
+		{
+			UE_LOG(LogClass, Display, TEXT("Projectile manager benchmark written to %s"), *SavedPath);
+		}
+	}
+
+	static FAutoConsoleCommand BenchmarkCommand(
+		TEXT("ProjectileManager.Benchmark"),
+		TEXT("Benchmarks the projectile pool in a transient world and writes json. Cases=PoolOperations,FreeList PoolSizes=1000,10000 Occupancies=0,0.5,0.99 Iterations=10000 Output=Path"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Execute_BenchmarkCommand));
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Transient World Methods										-
+//-----------------------------------------------------------------------------------
+/*	Creates and begins a game world of its own. 
+	@param: InName: The name of the world.
+*/
+FProjectileManagerTransientWorld::FProjectileManagerTransientWorld(const TCHAR* InName)
+{
+	if (!GEngine)
+	{
+		UE_LOG(LogClass, Error, TEXT("A transient projectile manager world needs the engine"));
+		return;
+	}
+
+	World = UWorld::CreateWorld(EWorldType::Game, false, InName);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+}
+
+/* Destroys the managers it spawned so they end play, then tears the world down. */
+FProjectileManagerTransientWorld::~FProjectileManagerTransientWorld()
+{
+	if (!World) return;
+
+	for (const TWeakObjectPtr<AProjectileManagerBase>& Manager : SpawnedManagers)
+	{
+		if (Manager.IsValid()) Manager->Destroy();
+	}
+	SpawnedManagers.Empty();
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	World = nullptr;
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+/*	Spawns a manager deferred, so its settings are set before begin play creates its pool. 
+	@param: InConfigure: Sets the managers settings.
+	@returns: the manager, null if it could not be spawned.
+*/
+AProjectileManagerBase* FProjectileManagerTransientWorld::SpawnManager(TFunctionRef<void(AProjectileManagerBase*)> InConfigure)
+{
+	if (!World) return nullptr;
+
+	AProjectileManagerBase* Manager = World->SpawnActorDeferred<AProjectileManagerBase>(AProjectileManagerBase::StaticClass(), FTransform::Identity);
+	if (!Manager) return nullptr;
+
+	InConfigure(Manager);
+	Manager->FinishSpawning(FTransform::Identity);
+	SpawnedManagers.Add(Manager);
+	return Manager;
+}
+
+/*	Ticks every tick group of the world once, as a frame would. 
+	@param: DeltaTime: The frame time.
+	@returns: the milliseconds the tick took.
+*/
+double FProjectileManagerTransientWorld::Tick(float DeltaTime)
+{
+	if (!World) return 0.0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	World->Tick(LEVELTICK_All, DeltaTime);
+	return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Benchmark Methods												-
+//-----------------------------------------------------------------------------------
+/*	Gets the name of every case. 
+	@param: OutCaseNames: The names, in the order the suite runs them.
+*/
+void FProjectileManagerBenchmark::GetCaseNames(TArray<FString>& OutCaseNames)
+{
+	OutCaseNames.Reset();
+	for (const ProjectileManagerBenchmark::FBenchmarkCase& Case : ProjectileManagerBenchmark::BenchmarkCases)
+	{
+		OutCaseNames.Add(Case.Name);
+	}
+}
+
+/*	Runs the cases the settings ask for, each one in the transient worlds it needs. 
+	@param: InSettings: The cases, pool sizes, occupancies and iterations.
+	@param: OutJson: The results, one object per case under its name.
+	@returns: if every case asked for ran.
+*/
+bool FProjectileManagerBenchmark::Run(const FProjectileManagerBenchmarkSettings& InSettings, FString& OutJson)
+{
+	if (!GEngine || InSettings.Iterations <= 0)
+	{
+		UE_LOG(LogClass, Error, TEXT("The projectile manager benchmark needs the engine and at least one iteration"));
+		return false;
+	}
+
+	for (const FString& CaseName : InSettings.Cases)
+	{
+		if (!ProjectileManagerBenchmark::FindCase(CaseName))
+		{
+			UE_LOG(LogClass, Error, TEXT("The projectile manager benchmark has no case named %s"), *CaseName);
+			return false;
+		}
+	}
+
+	bool bAllRan = true;
+	TSharedRef<FJsonObject> CaseResults = MakeShared<FJsonObject>();
+	for (const ProjectileManagerBenchmark::FBenchmarkCase& Case : ProjectileManagerBenchmark::BenchmarkCases)
+	{
+		if (InSettings.Cases.Num() > 0 && !InSettings.Cases.Contains(Case.Name)) continue;
+
+		TSharedRef<FJsonObject> CaseResult = MakeShared<FJsonObject>();
+		if (Case.RunFunction(InSettings, *CaseResult))
+		{
+			CaseResults->SetObjectField(Case.Name, CaseResult);
+		}
+		else
+		{
+			UE_LOG(LogClass, Error, TEXT("The projectile manager benchmark case %s could not run"), Case.Name);
+			bAllRan = false;
+		}
+	}
+
+	// the plugin version goes with the results so runs of different versions can be told apart. 
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("ProjectileManager"));
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("plugin_version"), Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("unknown"));
+	Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	Root->SetNumberField(TEXT("iterations"), InSettings.Iterations);
+	Root->SetObjectField(TEXT("cases"), CaseResults);
+
+	OutJson.Reset();
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
+	return FJsonSerializer::Serialize(Root, Writer) && bAllRan;
+}
+
+/*	Runs the benchmark and writes the json. 
+	@param: InSettings: The run, an empty output path writes to Saved/Benchmarks.
+	@param: OutSavedPath: Where the json was written.
+	@returns: if the json was written.
+*/
+bool FProjectileManagerBenchmark::RunAndSave(const FProjectileManagerBenchmarkSettings& InSettings, FString& OutSavedPath)
+{
+	FString Json;
+	if (!Run(InSettings, Json)) return false;
+
+	OutSavedPath = InSettings.OutputPath.IsEmpty() ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), FString::Printf(TEXT("ProjectileManager-%s.json"), *FDateTime::Now().ToString())) : InSettings.OutputPath;
+
+	if (!FFileHelper::SaveStringToFile(Json, *OutSavedPath))
+	{
+		UE_LOG(LogClass, Error, TEXT("Could not write the projectile manager benchmark to %s"), *OutSavedPath);
+		return false;
+	}
+
+	return true;
+}
+
+/*	Runs one case and writes its json. 
+	@param: InCaseName: The name of the case.
+	@param: InSettings: The run, the cases asked for are replaced by this one.
+	@param: OutSavedPath: Where the json was written, an empty output path writes Saved/Benchmarks/ProjectileManager-<Case>-<Time>.json.
+	@returns: if the case ran and its json was written.
+*/
+bool FProjectileManagerBenchmark::RunCaseAndSave(const FString& InCaseName, FProjectileManagerBenchmarkSettings InSettings, FString& OutSavedPath)
+{
+	InSettings.Cases = { InCaseName };
+	if (InSettings.OutputPath.IsEmpty())
+	{
+		InSettings.OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), FString::Printf(TEXT("ProjectileManager-%s-%s.json"), *InCaseName, *FDateTime::Now().ToString()));
+	}
+
+	return RunAndSave(InSettings, OutSavedPath);
+}
@@ -0,0 +1,374 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Collision/ProjectileTargetSpatialHash.h"
+
+// targets covering more cells than this are tested by every query instead of being bucketed. 
+static const int32 MaxCellsPerTarget = 64;
+
+//-----------------------------------------------------------------------------------
+// Projectile Target Spatial Hash Registration										-
+//-----------------------------------------------------------------------------------
+/*	Registers a target, reusing a free id if there is one. 
+	@param: InDescription: The shape, size and position of the target.
+	@param: InCallback: Called when a projectile touches the target.
+	@returns: the id of the target.
+*/
+int32 FProjectileTargetSpatialHash::AddTarget(const FProjectileTargetDescription& InDescription, const FOnProjectileTargetTouched& InCallback)
+{
+	const int32 TargetId = FreeIds.Num() > 0 ? FreeIds.Pop(false) : IdToDense.Add(INDEX_NONE);
+	const int32 DenseIndex = DenseToId.Add(TargetId);
+	IdToDense[TargetId] = DenseIndex;
+
+	CoreMinX.AddUninitialized();
+	CoreMinY.AddUninitialized();
+	CoreMinZ.AddUninitialized();
+	CoreMaxX.AddUninitialized();
+	CoreMaxY.AddUninitialized();
+	CoreMaxZ.AddUninitialized();
+	InflateRadii.Add(InDescription.GetInflateRadius());
+	CoreExtents.Add(InDescription.GetCoreExtent());
+	FollowActors.Add(InDescription.GetFollowActor());
+	Callbacks.Add(InCallback);
+	QueryStamps.Add(0);
+
+	SetDenseBounds(DenseIndex, InDescription.GetCurrentCenter());
+	return TargetId;
+}
+
+/*	Removes a target by swapping the last dense target into its place. The id is only 
+	reused after the next rebuild, a callback can remove a target while touches found 
+	for it are still being reported. 
+	@param: InTargetId: The id returned when the target was added.
+	@returns: if the target was registered.
+*/
+bool FProjectileTargetSpatialHash::RemoveTarget(int32 InTargetId)
+{
+	if (!IsTargetRegistered(InTargetId)) return false;
+	else
+	{
+		const int32 DenseIndex = IdToDense[InTargetId];
+		const int32 LastIndex = DenseToId.Num() - 1;
+
+		if (DenseIndex != LastIndex)
+		{
+			IdToDense[DenseToId[LastIndex]] = DenseIndex;
+		}
+
+		CoreMinX.RemoveAtSwap(DenseIndex, 1, false);
+		CoreMinY.RemoveAtSwap(DenseIndex, 1, false);
+		CoreMinZ.RemoveAtSwap(DenseIndex, 1, false);
+		CoreMaxX.RemoveAtSwap(DenseIndex, 1, false);
+		CoreMaxY.RemoveAtSwap(DenseIndex, 1, false);
+		CoreMaxZ.RemoveAtSwap(DenseIndex, 1, false);
+		InflateRadii.RemoveAtSwap(DenseIndex, 1, false);
+		CoreExtents.RemoveAtSwap(DenseIndex, 1, false);
+		FollowActors.RemoveAtSwap(DenseIndex, 1, false);
+		Callbacks.RemoveAtSwap(DenseIndex, 1, false);
+		QueryStamps.RemoveAtSwap(DenseIndex, 1, false);
+		DenseToId.RemoveAtSwap(DenseIndex, 1, false);
+
+		IdToDense[InTargetId] = INDEX_NONE;
+		RemovedIds.Add(InTargetId);
+		return true;
+	}
+}
+
+/*	Moves a target, it is re-bucketed on the next rebuild. 
+	@param: InTargetId: The target to move.
+	@param: InNewCenter: The new center of its bounds.
+	@returns: if the target was registered.
+*/
+bool FProjectileTargetSpatialHash::SetTargetCenter(int32 InTargetId, const FVector& InNewCenter)
+{
+	if (!IsTargetRegistered(InTargetId)) return false;
+	else
+	{
+		SetDenseBounds(IdToDense[InTargetId], InNewCenter);
+		return true;
+	}
+}
+
+/*	Gets the callback of a target. 
+	@param: InTargetId: The target.
+	@returns: the callback or null if the target is not registered.
+*/
+const FOnProjectileTargetTouched* FProjectileTargetSpatialHash::GetTargetCallback(int32 InTargetId) const
+{
+	return IsTargetRegistered(InTargetId) ? &Callbacks[IdToDense[InTargetId]] : nullptr;
+}
+
+/*	Gets the actor a target follows. 
+	@param: InTargetId: The target.
+	@returns: the actor or null if it has none.
+*/
+AActor* FProjectileTargetSpatialHash::GetTargetActor(int32 InTargetId) const
+{
+	return IsTargetRegistered(InTargetId) ? FollowActors[IdToDense[InTargetId]].Get() : nullptr;
+}
+
+/* Empties every array. */
+void FProjectileTargetSpatialHash::Reset()
+{
+	CoreMinX.Empty();
+	CoreMinY.Empty();
+	CoreMinZ.Empty();
+	CoreMaxX.Empty();
+	CoreMaxY.Empty();
+	CoreMaxZ.Empty();
+	InflateRadii.Empty();
+	CoreExtents.Empty();
+	FollowActors.Empty();
+	Callbacks.Empty();
+	DenseToId.Empty();
+	IdToDense.Empty();
+	FreeIds.Empty();
+	RemovedIds.Empty();
+	BucketStarts.Empty();
+	BucketEntries.Empty();
+	BucketCursors.Empty();
+	OversizedTargets.Empty();
+	QueryStamps.Empty();
+	Candidates.Empty();
+	BucketMask = 0;
+	CurrentQueryStamp = 0;
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Target Spatial Hash Buckets											-
+//-----------------------------------------------------------------------------------
+/*	Follows the actors and rebuilds the buckets. The entries are counted per bucket, 
+	the counts are turned into start offsets, then the entries are written in place. 
+	Touches are only collected after a rebuild, so the removed ids can be freed here. 
+	@param: InCellSize: The edge length of a grid cell, in world units.
+*/
+void FProjectileTargetSpatialHash::Rebuild(float InCellSize)
+{
+	InvCellSize = 1.f / FMath::Max(InCellSize, 1.f);
+	FreeIds.Append(RemovedIds);
+	RemovedIds.Reset();
+
+	// pull the targets that follow an actor along with it. 
+	for (int32 i = 0; i < DenseToId.Num(); i++)
+	{
+		if (AActor* Actor = FollowActors[i].Get())
+		{
+			SetDenseBounds(i, Actor->GetActorLocation());
+		}
+	}
+
+	// twice as many buckets as targets keeps the chains short, always a power of two. 
+	const int32 NumBuckets = FMath::RoundUpToPowerOfTwo(FMath::Max(DenseToId.Num() * 2, 16));
+	BucketMask = NumBuckets - 1;
+	BucketStarts.Reset();
+	BucketStarts.AddZeroed(NumBuckets + 1);
+	OversizedTargets.Reset();
+
+	// visits every cell a dense target covers, returns false if it covers too many. 
+	auto ForEachTargetCell = [this](int32 DenseIndex, TFunctionRef<void(int32)> Visit)
+	{
+		const float Inflate = InflateRadii[DenseIndex];
+		const FIntVector Min = GetCell(FVector(CoreMinX[DenseIndex] - Inflate, CoreMinY[DenseIndex] - Inflate, CoreMinZ[DenseIndex] - Inflate));
+		const FIntVector Max = GetCell(FVector(CoreMaxX[DenseIndex] + Inflate, CoreMaxY[DenseIndex] + Inflate, CoreMaxZ[DenseIndex] + Inflate));
+		const int64 NumCells = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1) * int64(Max.Z - Min.Z + 1);
+		if (NumCells > MaxCellsPerTarget) return false;
+
+		for (int32 X = Min.X; X <= Max.X; X++)
+			for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+				for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+					Visit(GetBucket(FIntVector(X, Y, Z)));
+		return true;
+	};
+
+	// count, oversized targets go to their own list. 
+	for (int32 i = 0; i < DenseToId.Num(); i++)
+	{
+		if (!ForEachTargetCell(i, [this](int32 Bucket) { BucketStarts[Bucket + 1]++; }))
+		{
+			OversizedTargets.Add(i);
+		}
+	}
+
+	// offsets. 
+	for (int32 b = 0; b < NumBuckets; b++)
+	{
+		BucketStarts[b + 1] += BucketStarts[b];
+	}
+
+	// fill, using a copy of the starts as the write cursors. 
+	BucketEntries.SetNumUninitialized(BucketStarts[NumBuckets], false);
+	BucketCursors.Reset();
+	BucketCursors.Append(BucketStarts.GetData(), NumBuckets);
+
+	int32 OversizedCursor = 0;
+	for (int32 i = 0; i < DenseToId.Num(); i++)
+	{
+		if (OversizedTargets.IsValidIndex(OversizedCursor) && OversizedTargets[OversizedCursor] == i)
+		{
+			OversizedCursor++;
+			continue;
+		}
+
+		ForEachTargetCell(i, [this, i](int32 Bucket) { BucketEntries[BucketCursors[Bucket]++] = i; });
+	}
+}
+
+/*	Finds the targets a sphere touches. Cells hash into shared buckets, so a bucket can hold 
+	targets from far away, the narrowphase rejects those. 
+	@param: InCenter: The center of the projectile.
+	@param: InRadius: The collision radius of the projectile.
+	@param: OutTargetIds: The ids of the touched targets are appended.
+*/
+void FProjectileTargetSpatialHash::QueryTouchingTargets(const FVector& InCenter, float InRadius, TArray<int32>& OutTargetIds)
+{
+	if (DenseToId.Num() == 0 || BucketStarts.Num() == 0) return;
+
+	// a new stamp per query, so a target in several of the cells is only tested once. 
+	if (++CurrentQueryStamp == 0)
+	{
+		FMemory::Memzero(QueryStamps.GetData(), QueryStamps.Num() * sizeof(uint32));
+		CurrentQueryStamp = 1;
+	}
+	Candidates.Reset();
+
+	const FIntVector Min = GetCell(InCenter - FVector(InRadius));
+	const FIntVector Max = GetCell(InCenter + FVector(InRadius));
+	for (int32 X = Min.X; X <= Max.X; X++)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+		{
+			for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+			{
+				const int32 Bucket = GetBucket(FIntVector(X, Y, Z));
+				for (int32 e = BucketStarts[Bucket], End = BucketStarts[Bucket + 1]; e < End; e++)
+				{
+					AddCandidate(BucketEntries[e]);
+				}
+			}
+		}
+	}
+
+	for (int32 DenseIndex : OversizedTargets)
+	{
+		AddCandidate(DenseIndex);
+	}
+
+	TestCandidates(InCenter, InRadius, OutTargetIds);
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Target Spatial Hash Helpers											-
+//-----------------------------------------------------------------------------------
+/*	Writes the core box of a dense target around a center. 
+	@param: InDenseIndex: The dense target.
+	@param: InCenter: The center of the target.
+*/
+void FProjectileTargetSpatialHash::SetDenseBounds(int32 InDenseIndex, const FVector& InCenter)
+{
+	const FVector& Extent = CoreExtents[InDenseIndex];
+	CoreMinX[InDenseIndex] = InCenter.X - Extent.X;
+	CoreMinY[InDenseIndex] = InCenter.Y - Extent.Y;
+	CoreMinZ[InDenseIndex] = InCenter.Z - Extent.Z;
+	CoreMaxX[InDenseIndex] = InCenter.X + Extent.X;
+	CoreMaxY[InDenseIndex] = InCenter.Y + Extent.Y;
+	CoreMaxZ[InDenseIndex] = InCenter.Z + Extent.Z;
+}
+
+/*	Gets the cell a location falls in. 
+	@param: InLocation: The world location.
+	@returns: the integer cell coordinates.
+*/
+FIntVector FProjectileTargetSpatialHash::GetCell(const FVector& InLocation) const
+{
+	return FIntVector(FMath::FloorToInt(InLocation.X * InvCellSize), FMath::FloorToInt(InLocation.Y * InvCellSize), FMath::FloorToInt(InLocation.Z * InvCellSize));
+}
+
+/*	Hashes a cell into a bucket. 
+	@param: InCell: The cell coordinates.
+	@returns: the bucket index.
+*/
+int32 FProjectileTargetSpatialHash::GetBucket(const FIntVector& InCell) const
+{
+	const uint32 Hash = (uint32(InCell.X) * 73856093u) ^ (uint32(InCell.Y) * 19349663u) ^ (uint32(InCell.Z) * 83492791u);
+	return int32(Hash & uint32(BucketMask));
+}
+
+/*	Adds a candidate if this query has not seen it yet. 
+	@param: InDenseIndex: The dense target.
+*/
+void FProjectileTargetSpatialHash::AddCandidate(int32 InDenseIndex)
+{
+	if (QueryStamps[InDenseIndex] != CurrentQueryStamp)
+	{
+		QueryStamps[InDenseIndex] = CurrentQueryStamp;
+		Candidates.Add(InDenseIndex);
+	}
+}
+
+/*	Sphere against inflated box, four candidates per vector instruction. The sphere center is 
+	clamped into each core box, it touches when the clamped distance is within the sphere radius 
+	plus the inflate radius. The last group is padded with its final candidate and masked off. 
+	@param: InCenter: The center of the projectile.
+	@param: InRadius: The collision radius of the projectile.
+	@param: OutTargetIds: The ids of the touched targets are appended.
+*/
+void FProjectileTargetSpatialHash::TestCandidates(const FVector& InCenter, float InRadius, TArray<int32>& OutTargetIds) const
+{
+	const int32 NumCandidates = Candidates.Num();
+	if (NumCandidates == 0) return;
+
+	const VectorRegister CenterX = VectorSetFloat1(InCenter.X);
+	const VectorRegister CenterY = VectorSetFloat1(InCenter.Y);
+	const VectorRegister CenterZ = VectorSetFloat1(InCenter.Z);
+	const VectorRegister Radius = VectorSetFloat1(InRadius);
+
+	for (int32 Base = 0; Base < NumCandidates; Base += 4)
+	{
+		const int32 Lanes = FMath::Min(4, NumCandidates - Base);
+		const int32 C0 = Candidates[Base];
+		const int32 C1 = Candidates[Base + FMath::Min(1, Lanes - 1)];
+		const int32 C2 = Candidates[Base + FMath::Min(2, Lanes - 1)];
+		const int32 C3 = Candidates[Base + FMath::Min(3, Lanes - 1)];
+
+		const VectorRegister MinX = MakeVectorRegister(CoreMinX[C0], CoreMinX[C1], CoreMinX[C2], CoreMinX[C3]);
+		const VectorRegister MinY = MakeVectorRegister(CoreMinY[C0], CoreMinY[C1], CoreMinY[C2], CoreMinY[C3]);
+		const VectorRegister MinZ = MakeVectorRegister(CoreMinZ[C0], CoreMinZ[C1], CoreMinZ[C2], CoreMinZ[C3]);
+		const VectorRegister MaxX = MakeVectorRegister(CoreMaxX[C0], CoreMaxX[C1], CoreMaxX[C2], CoreMaxX[C3]);
+		const VectorRegister MaxY = MakeVectorRegister(CoreMaxY[C0], CoreMaxY[C1], CoreMaxY[C2], CoreMaxY[C3]);
+		const VectorRegister MaxZ = MakeVectorRegister(CoreMaxZ[C0], CoreMaxZ[C1], CoreMaxZ[C2], CoreMaxZ[C3]);
+		const VectorRegister Inflate = MakeVectorRegister(InflateRadii[C0], InflateRadii[C1], InflateRadii[C2], InflateRadii[C3]);
+
+		// distance from the center to the closest point of each core box. 
+		const VectorRegister DX = VectorSubtract(CenterX, VectorMin(VectorMax(CenterX, MinX), MaxX));
+		const VectorRegister DY = VectorSubtract(CenterY, VectorMin(VectorMax(CenterY, MinY), MaxY));
+		const VectorRegister DZ = VectorSubtract(CenterZ, VectorMin(VectorMax(CenterZ, MinZ), MaxZ));
+		const VectorRegister DistSquared = VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+
+		const VectorRegister Reach = VectorAdd(Radius, Inflate);
+		const int32 Touching = VectorMaskBits(VectorCompareGE(VectorMultiply(Reach, Reach), DistSquared)) & ((1 << Lanes) - 1);
+		if (Touching == 0) continue;
+
+		for (int32 Lane = 0; Lane < Lanes; Lane++)
+		{
+			if (Touching & (1 << Lane))
+			{
+				OutTargetIds.Add(DenseToId[Candidates[Base + Lane]]);
+			}
+		}
+	}
+}
@@ -0,0 +1,169 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Expiry/ProjectileExpiryWheel.h"
+
+//-----------------------------------------------------------------------------------
+// Projectile Expiry Wheel Scheduling												-
+//-----------------------------------------------------------------------------------
+/*	Empties the wheel, the scheduled expiries are dropped. 
+	@param: InResolutionSeconds: The length of one wheel tick.
+*/
+void FProjectileExpiryWheel::Reset(float InResolutionSeconds)
+{
+	Nodes.Reset();
+	FreeNodeHead = INDEX_NONE;
+	for (int32& SlotHead : SlotHeads) SlotHead = INDEX_NONE;
+
+	CurrentTick = 0;
+	ResolutionSeconds = FMath::Max(InResolutionSeconds, KINDA_SMALL_NUMBER);
+	AccumulatedTime = 0.f;
+	NumScheduled = 0;
+}
+
+/*	Schedules an expiry, it comes due on the first tick at or after the delay. 
+	@param: InExpiry: The expiry to schedule.
+	@param: InDelaySeconds: The delay from now, capped by the lifetime tick of the expiry.
+*/
+void FProjectileExpiryWheel::Schedule(const FProjectileExpiry& InExpiry, float InDelaySeconds)
+{
+	const int32 NodeIndex = FreeNodeHead != INDEX_NONE ? FreeNodeHead : Nodes.AddDefaulted();
+	if (NodeIndex == FreeNodeHead) FreeNodeHead = Nodes[NodeIndex].Next;
+
+	FNode& Node = Nodes[NodeIndex];
+	Node.Expiry = InExpiry;
+	Node.DueTick = FMath::Max(FMath::Min(GetTickAfter(InDelaySeconds), InExpiry.LifetimeTick), CurrentTick + 1);
+
+	Insert(NodeIndex);
+	NumScheduled++;
+}
+
+/*	Moves time forward a tick at a time, every slot that comes up is moved down or expired. 
+	@param: DeltaTime: The frame time.
+	@param: OutDueExpiries: The expiries that came due, appended to.
+	@returns: the number of expiries that came due.
+*/
+int32 FProjectileExpiryWheel::Advance(float DeltaTime, TArray<FProjectileExpiry>& OutDueExpiries)
+{
+	const int32 NumAtStart = OutDueExpiries.Num();
+	AccumulatedTime += DeltaTime;
+
+	while (AccumulatedTime >= ResolutionSeconds)
+	{
+		AccumulatedTime -= ResolutionSeconds;
+		CurrentTick++;
+
+		// a tick starting a block of a level moves that blocks slot down, highest level first 
+		// so a node moved down more than one level is still moved again on this tick. 
+		int32 HighestLevel = 0;
+		while (HighestLevel + 1 < NumLevels && (CurrentTick & ((int64(1) << (SlotBits * (HighestLevel + 1))) - 1)) == 0)
+		{
+			HighestLevel++;
+		}
+
+		for (int32 Level = HighestLevel; Level > 0; Level--)
+		{
+			Cascade(Level, int32((CurrentTick >> (SlotBits * Level)) & (SlotsPerLevel - 1)));
+		}
+
+		// expire the level 0 slot, a node capped to the range of the wheel goes back in. 
+		const int32 Head = GetSlotHead(0, int32(CurrentTick & (SlotsPerLevel - 1)));
+		int32 NodeIndex = SlotHeads[Head];
+		SlotHeads[Head] = INDEX_NONE;
+
+		while (NodeIndex != INDEX_NONE)
+		{
+			const int32 NextIndex = Nodes[NodeIndex].Next;
+
+			if (Nodes[NodeIndex].DueTick > CurrentTick)
+			{
+				Insert(NodeIndex);
+			}
+			else
+			{
+				OutDueExpiries.Add(Nodes[NodeIndex].Expiry);
+				Nodes[NodeIndex].Next = FreeNodeHead;
+				FreeNodeHead = NodeIndex;
+				NumScheduled--;
+			}
+
+			NodeIndex = NextIndex;
+		}
+	}
+
+	return OutDueExpiries.Num() - NumAtStart;
+}
+
+/*	Gets the wheel tick a delay from now falls on, at least one tick away. 
+	@param: InDelaySeconds: The delay from now.
+	@returns: the wheel tick.
+*/
+int64 FProjectileExpiryWheel::GetTickAfter(float InDelaySeconds) const
+{
+	const double Ticks = FMath::CeilToDouble((double(InDelaySeconds) + AccumulatedTime) / ResolutionSeconds);
+	return CurrentTick + FMath::Clamp<int64>(int64(FMath::Min(Ticks, double(MAX_int64 / 2))), 1, MAX_int64 / 2);
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Expiry Wheel Helpers													-
+//-----------------------------------------------------------------------------------
+/*	Links a node into the lowest level whose next 64 slots reach its due tick. A node past the 
+	range of the top level is linked into the furthest top slot and goes back in from there. 
+	@param: InNodeIndex: The node to link.
+*/
+void FProjectileExpiryWheel::Insert(int32 InNodeIndex)
+{
+	FNode& Node = Nodes[InNodeIndex];
+
+	int32 Level = 0;
+	int64 DueBlock = Node.DueTick;
+
+	for (; Level < NumLevels; Level++)
+	{
+		DueBlock = Node.DueTick >> (SlotBits * Level);
+		if (DueBlock - (CurrentTick >> (SlotBits * Level)) < SlotsPerLevel) break;
+	}
+
+	if (Level == NumLevels)
+	{
+		Level = NumLevels - 1;
+		DueBlock = (CurrentTick >> (SlotBits * Level)) + SlotsPerLevel - 1;
+	}
+
+	const int32 Head = GetSlotHead(Level, int32(DueBlock & (SlotsPerLevel - 1)));
+	Node.Next = SlotHeads[Head];
+	SlotHeads[Head] = InNodeIndex;
+}
+
+/*	Moves every node in a slot down, its block has just started so they all fit below. 
+	@param: InLevel: The level of the slot.
+	@param: InSlot: The slot in the level.
+*/
+void FProjectileExpiryWheel::Cascade(int32 InLevel, int32 InSlot)
+{
+	const int32 Head = GetSlotHead(InLevel, InSlot);
+	int32 NodeIndex = SlotHeads[Head];
+	SlotHeads[Head] = INDEX_NONE;
+
+	while (NodeIndex != INDEX_NONE)
+	{
+		const int32 NextIndex = Nodes[NodeIndex].Next;
+		Insert(NodeIndex);
+		NodeIndex = NextIndex;
+	}
+}
@@ -1,442 +1,2386 @@
-/*	Copyright / License  Disclaimer
- *	MIT Copyright 2020 Nicholas Mallonee
- *	Permission is hereby granted, free of charge, to any person obtaining a 
- *	copy of this software and associated documentation files(the "Software"), to deal 
- *	in the Software without restriction, including without limitation the rights to use, 
- *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
- *	Software, and to permit persons to whom the Software is furnished to do so, subject 
- *	to the following conditions :
- *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
- *	
- *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
- *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
- *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
- *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
- *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
- *	OTHER DEALINGS IN THE SOFTWARE.
- */
-
-#include "ProjectileManager/Public/Manager/ProjectileManagerBase.h"
-#include "Kismet/GameplayStatics.h"
-
-//-----------------------------------------------------------------------------------
-// Projectile Manager Base Class Constructor										-
-//-----------------------------------------------------------------------------------
-AProjectileManagerBase::AProjectileManagerBase()
-{
- 	// -- Actor Class Defaults
-	PrimaryActorTick.bCanEverTick = false;
-}
-
-//-----------------------------------------------------------------------------------
-// Projectile Manager Base Class Engine Events										-
-//-----------------------------------------------------------------------------------
-/* Engine Begin play Event */
-void AProjectileManagerBase::BeginPlay()
-{
-	// create the pool. 
-	Create_ProjectilePool(GetInitProjectilePoolSize());
-
-	Super::BeginPlay();	
-}
-
-/* Engine Tick Event */
-void AProjectileManagerBase::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-}
-
-/* Engine Endplay Event */
-void AProjectileManagerBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
-{
-	// clean up the pool. 
-	CleanUp_ProjectilePool();
-
-	Super::EndPlay(EndPlayReason);
-}
-
-//-----------------------------------------------------------------------------------
-// Projectile Manager Base Methods													-
-//-----------------------------------------------------------------------------------
-/*	Requests a pool resize 
-	@param: InNewProjectilePoolSize: The new pool size to try and set. 
-	@returns: if we were able to set the pool to the new size. 
-*/
-bool AProjectileManagerBase::Request_ResizeProjectilePool(int32& InNewProjectilePoolSize)
-{
-	return Resize_ProjectilePool(InNewProjectilePoolSize);
-}
-
-/*	Attempts to get a new projectile.
-@param: OutProjectileToUse: The pointer to the projectile as returned by reference.
-@returns: if we were able to get a projectile.
-*/
-bool AProjectileManagerBase::Request_GetProjectileFromManager(AManagedProjectileBase*& OutProjectileToUse, FProjectilePoolRequest& RetreieveSettings)
-{
-	if (GetCurrentPoolSize() <= 0)
-	{
-		UE_LOG(LogClass, Error, TEXT("Current pool size is 0; cant pull any projectiles out of it"));
-		OutProjectileToUse = nullptr;
-		return false;
-	}
-	else
-	{
-		// find the next entry. 
-		int32 found = FindFirstAvalibleIndex(ShouldRetreieveFromTheFrontOfThePool());
-
-		// if the entry is valid. 
-		if (found >= 0)
-		{
-			// mark itas being used, make sure the entry is up to date to speed up the return.
-			OutProjectileToUse = ManagedPool[found].MarkEntryInUse(found);
-
-			// apply the pull settings and return. 
-			return OutProjectileToUse ? OutProjectileToUse->Request_UpdateFromPool(RetreieveSettings) : false;
-		}
-		else
-		{
-			UE_LOG(LogClass, Error, TEXT("Could not find a projectile to return, try making your pool bigger."));
-			OutProjectileToUse = nullptr;
-			return false;
-		}
-	}
-}
-
-/*	Attempts to return a projectile to the pool. 
-	@param: InProjectileToReturn: The pointer to the projectile to return. 
-	@returns: if we were able to return the projectile. 
-*/
-bool AProjectileManagerBase::Request_ReturnProjectileToManager(AManagedProjectileBase*& InProjectileToReturn)
-{
-	if (!InProjectileToReturn)
-	{
-		UE_LOG(LogClass, Error, TEXT("Attempted to return nullptr to pool"));
-		return false;
-	}
-	else
-	{
-		// verify its in the pool. 
-		int32 found = FindIndexFromPointer(ShouldRetreieveFromTheFrontOfThePool(), InProjectileToReturn);
-
-		if (found >= 0)
-		{
-			// if we need to remove on return. 
-			if (bNeedToRemoveOnReturn)
-			{
-				ManagedPool[found].CleanUpEntry();
-				ManagedPool.RemoveAt(found, 1, true);
-
-				// switch the flag, if have met our goal, will be the not of if we hit our target.
-				bNeedToRemoveOnReturn = !(GetCurrentPoolSize() == CurrentPoolSizeTarget);
-
-				return true;
-			}
-			else
-			{
-				// if we have optimized search 
-				if (OptimizeRequestsWithCachingLastReturned())
-				{
-					// mark this one as last returned. 
-					UpdateLastReturnedEntry(found);
-				}
-
-				// mark as it nots in use
-				ManagedPool[found].UnMarkEntryInUse();
-
-				// apply the return settings.
-				return InProjectileToReturn->Request_UpdateFromPool(RetrieveReturnSettings.ReturnProjectileRequest);
-			}
-		}
-		else
-		{
-			UE_LOG(LogClass, Error, TEXT("Inputed object to return to the pool does not exist as an entry in the managed pool"));
-			return false;
-		}
-	}
-}
-
-/* Returns the current managed pool size. */
-int32 AProjectileManagerBase::GetCurrentPoolSize() const
-{
-	return ManagedPool.Num();
-}
-
-//-----------------------------------------------------------------------------------
-// Projectile Manager Base Class Internal Methods									-
-//-----------------------------------------------------------------------------------
-/*  Creates a  new pool, or adds on to the current one 
-	@param: DesiredSize: The Desired size the pool should be. 
-	@returns: boolean if the operation is successful.
-*/
-bool AProjectileManagerBase::Create_ProjectilePool(int32 DesiredSize)
-{
-	if (DesiredSize <= 0 || DesiredSize - GetCurrentPoolSize() <= 0)
-	{
-		UE_LOG(LogClass, Error, TEXT("Projectile Manager Can not allocate a projectile pool at or below the value of 0. Requested Size: %d"), DesiredSize);
-		return false;
-	}
-	else
-	{
-		UWorld* const world = GetWorld();
-
-		if (!world) return false;
-		else
-		{
-			// set up spawn params
-			FActorSpawnParameters spawnParams;
-			spawnParams.Owner = this;
-			spawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-			spawnParams.Instigator = nullptr;
-
-			// the amount to create.  
-			int32 AmountToCreate = DesiredSize - GetCurrentPoolSize();
-
-			// create the pool 
-			for (int32 i = 0; i < AmountToCreate; i++)
-			{
-				// spawn a projectile 
-				if (AManagedProjectileBase* projectile = world->SpawnActor<AManagedProjectileBase>(GetProjectileClassToUse(), GetPoolLocation(), FRotator::ZeroRotator, spawnParams))
-				{
-					// set if the projectiles outside collision needs to be on at start or not. 
-					projectile->Request_UpdateFromPool(GetReturnRequestSettings());
-
-					// add this object to the record as needed, save this object as the deleter. 
-					ManagedPool.Add(FManagedProjectileEntry(projectile));
-
-					// set the projectile up if we want to have it tick async to the game thread. 
-					projectile->Requst_TickMoveToAsync(OptimizeProjectilesMustTickAsync());
-				}
-			}
-
-			// did we complete successfully? 
-			return GetCurrentPoolSize() == DesiredSize;
-		}
-	}
-}
-
-/* Resizes the pool to a desired size if possible. 
-	@param: InNewProjectilePoolSize: the requested size of the pool. 
-	@return: if the pool was resized. 
-*/
-bool AProjectileManagerBase::Resize_ProjectilePool(int32& InNewProjectilePoolSize)
-{
-	if (InNewProjectilePoolSize <= 0)
-	{
-		UE_LOG(LogClass, Error, TEXT("Can not resize projectile manager pool to any value less than 1, you requested a value of %d for the new pool size"), InNewProjectilePoolSize);
-		return false;
-	}
-	else if (InNewProjectilePoolSize == GetCurrentPoolSize())
-	{
-		UE_LOG(LogClass, Error, TEXT("No Need to resize the managed pool as the requested size is the current pool size."));
-		return false;
-	}
-	else
-	{
-		// if we need to allocate more. 
-		if (InNewProjectilePoolSize > GetCurrentPoolSize())
-		{
-			// update the pool with the new target amount
-			return Create_ProjectilePool(InNewProjectilePoolSize);
-		}
-		else // else if we need to remove some from the pool. 
-		{
-			TArray<int32> PotentialIndexs; 
-			int32 NumToRemove = GetCurrentPoolSize() - InNewProjectilePoolSize;
-
-			// if we didnt find enough to remove, any incoming should be removed. 
-			if (!FindPotentialEntriesToRemove(PotentialIndexs, NumToRemove))
-			{
-				bNeedToRemoveOnReturn = true;
-				CurrentPoolSizeTarget = InNewProjectilePoolSize;
-			}
-
-			// return if we finished successfully. 
-			return AttemptToRemoveEntries(PotentialIndexs, NumToRemove, InNewProjectilePoolSize);
-		}
-	}
-}
-
-/* Deallocated the whole pool. */
-bool AProjectileManagerBase::CleanUp_ProjectilePool()
-{
-	if (ManagedPool.Num() <= 0) return false;
-	else
-	{
-		// clean up the allocated objects
-		for (FManagedProjectileEntry Record : ManagedPool)
-		{
-			Record.CleanUpEntry();
-		}
-
-		// remove all records. 
-		ManagedPool.Empty();
-
-		// return true;
-		return true;
-	}	
-}
-
-/*	Attempts to find a list a potential entries to remove starting from the back of the pool 
-	@param: OutPotentialIndexs: Out entry indexes to remove
-	@param: InNumWantingToRemove: The number of entries we want to remove. 
-	@return: boolean if we found any to remove
-*/
-bool AProjectileManagerBase::FindPotentialEntriesToRemove(TArray<int32>& OutPotentialIndexs, int32& InNumWantingToRemove)
-{
-	// make sure the data is valid. 
-	OutPotentialIndexs.Empty();
-
-	// if we currently work from the front, start at the back. 
-	if (ShouldRetreieveFromTheFrontOfThePool())
-	{
-		for (int32 i = ManagedPool.Num() - 1; i >= 0; i--)
-		{
-			if (!ManagedPool[i].IsInUse())
-			{
-				// add. 
-				OutPotentialIndexs.Add(i);
-
-				// if we found enough, break out. 
-				if (OutPotentialIndexs.Num() >= InNumWantingToRemove)
-					break;
-			}
-		}
-	}
-	else // else start from the front. 
-	{
-		// find candidates 
-		for (int32 i = 0; i < ManagedPool.Num(); i++)
-		{
-			if (!ManagedPool[i].IsInUse())
-			{
-				// add. 
-				OutPotentialIndexs.Add(i);
-
-				// if we found enough, break out. 
-				if (OutPotentialIndexs.Num() >= InNumWantingToRemove)
-					break;
-			}
-		}
-	}
-
-	return OutPotentialIndexs.Num() > 0;
-}
-
-/* Attempts to remove entry from the pool. 
-	@param: InPotentialIndexs: The indexs we want to remove. 
-	@param: InNumToRemove: The number of entries to remove
-	@param: CurrentPoolTargetSize: The Target Pool size we want.
-	@returns: if the resize finished successfull. 
-*/
-bool AProjectileManagerBase::AttemptToRemoveEntries(TArray<int32>& InPotentialIndexs, int32& InNumToRemove, int32& CurrentPoolTargetSize)
-{
-	// for each index.
-	for (int32 index : InPotentialIndexs)
-	{
-		// find and remove the entry with that index. 
-		for (int32 i = ManagedPool.Num() - 1; i >= 0; i--)
-		{
-			if (i == index)
-			{
-				// clean up the entry
-				ManagedPool[index].CleanUpEntry();
-
-				// remove
-				ManagedPool.RemoveAt(index, 1, true);
-
-				// reduce.
-				InNumToRemove--;
-			}
-		}
-	}
-
-	// if we removed what we needed too, go ahead return the result, else return true, as we will remove more on their return.
-	// the timing of the return is up to the application. 
-	return !bNeedToRemoveOnReturn ? GetCurrentPoolSize() == CurrentPoolTargetSize : true;
-}
-
-bool AProjectileManagerBase::DoWeHaveValidLastKnownEntry(int32& OutEntry)
-{
-	OutEntry = GlobalSettings.GetLastReturnedEntry();
-	return OutEntry >= 0 && OutEntry < ManagedPool.Num() && !ManagedPool[OutEntry].IsInUse();
-}
-
-/*	Finds the first availble projectile index. 
-	@param: bFromFront: do we start the search from the front or the back?
-	@return: the index of the entry, -1 if not found.
-*/
-int32 AProjectileManagerBase::FindFirstAvalibleIndex(bool bFromFront)
-{
-	// check if we can use an optimized search. 
-	int32 PotentialEntry = -1;
-	if (OptimizeRequestsWithCachingLastReturned() && DoWeHaveValidLastKnownEntry(PotentialEntry))
-	{
-		// return the one we found.
-		return PotentialEntry;
-	}
-	else // else use the default search 
-	{
-		if (bFromFront)
-		{
-			for (PotentialEntry = 0; PotentialEntry < ManagedPool.Num(); PotentialEntry++)
-			{
-				if (!ManagedPool[PotentialEntry].IsInUse()) return PotentialEntry;
-			}
-
-			return -1;
-		}
-		else
-		{
-			for (PotentialEntry = ManagedPool.Num(); PotentialEntry >= 0; --PotentialEntry)
-			{
-				if (!ManagedPool[PotentialEntry].IsInUse()) return PotentialEntry;
-			}
-
-			return -1;
-		}
-	}	
-}
-
-/*	Finds the entry index from a pointer to a projectile. 
-	@param: bFromFront: do we start the search from the front or the back?
-	@param: InProjectileToReturn: The projectile to return. 
-	@return: the index of the entry, -1 if not found.
-*/
-int32 AProjectileManagerBase::FindIndexFromPointer(bool bFromFront, AManagedProjectileBase*& InProjectileToReturn)
-{
-	if (!InProjectileToReturn) return -1;
-	else
-	{
-		// see if its last know entry is the currenty entry to reduce search time.
-		int32 idx = InProjectileToReturn->GetLastKnownEntryInPool();
-
-		// if its a valid index. 
-		if (idx >= 0 && idx < ManagedPool.Num() && ManagedPool[idx].IsEntry(InProjectileToReturn)) return idx;
-		else
-		{
-			if (bFromFront)
-			{
-				for (int32 i = 0; i < ManagedPool.Num(); i++)
-				{
-					if (ManagedPool[i].IsEntry(InProjectileToReturn)) return i;
-				}
-
-				return -1;
-			}
-			else
-			{
-				for (int32 i = ManagedPool.Num(); i >= 0; --i)
-				{
-					if (ManagedPool[i].IsEntry(InProjectileToReturn)) return i;
-				}
-
-				return -1;
-			}
-		}			
-	}
-}
-
-void AProjectileManagerBase::UpdateLastReturnedEntry(int32 InEntryKey)
-{
-	GlobalSettings.AddLastReturned(InEntryKey);
-}
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Manager/ProjectileManagerBase.h"
+#include "ProjectileManager/Public/Simulation/ProjectileBallisticKernel.h"
+#include "ProjectileManager/Public/Subsystem/ProjectileManagerSubsystem.h"
+#include "ProjectileManager/Public/Stats/ProjectileManagerStats.h"
+#include "Kismet/GameplayStatics.h"
+#include "Async/ParallelFor.h"
+#include "GameFramework/WorldSettings.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+// a projectile short of its travel limit is checked again at least this often, it may have slowed down. 
+static const float MaxTravelRecheckSeconds = 0.5f;
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Base Class Constructor										-
+//-----------------------------------------------------------------------------------
+AProjectileManagerBase::AProjectileManagerBase()
+{
+ 	// -- Actor Class Defaults, the tick is only enabled to simulate the data mode
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	// -- Return pass, only enabled while there are returns queued
+	ReturnTickFunction.bCanEverTick = true;
+	ReturnTickFunction.bStartWithTickEnabled = false;
+	ReturnTickFunction.TickGroup = TG_PostUpdateWork;
+
+	// -- Batched projectile tick, runs where the movement components would have, only enabled in the batched tick mode
+	BatchTickFunction.bCanEverTick = true;
+	BatchTickFunction.bStartWithTickEnabled = false;
+	BatchTickFunction.TickGroup = TG_PrePhysics;
+
+	// -- Instanced mesh update, runs after the frames moves and returns, only enabled in the instanced mesh render mode
+	InstanceTickFunction.bCanEverTick = true;
+	InstanceTickFunction.bStartWithTickEnabled = false;
+	InstanceTickFunction.TickGroup = TG_PostUpdateWork;
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Return Tick Function											-
+//-----------------------------------------------------------------------------------
+/* Tick function event, processes the queued returns */
+void FProjectileManagerReturnTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && !Target->IsPendingKill())
+	{
+		Target->ProcessPendingReturns();
+	}
+}
+
+/* Tick function name for the diagnostics */
+FString FProjectileManagerReturnTickFunction::DiagnosticMessage()
+{
+	return Target ? Target->GetFullName() + TEXT("[ReturnTick]") : TEXT("ProjectileManager[ReturnTick]");
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Batch Tick Function											-
+//-----------------------------------------------------------------------------------
+/* Tick function event, moves the live projectiles */
+void FProjectileManagerBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && !Target->IsPendingKill() && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Target->Tick_BatchedProjectiles(DeltaTime);
+	}
+}
+
+/* Tick function name for the diagnostics */
+FString FProjectileManagerBatchTickFunction::DiagnosticMessage()
+{
+	return Target ? Target->GetFullName() + TEXT("[BatchTick]") : TEXT("ProjectileManager[BatchTick]");
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Instance Tick Function										-
+//-----------------------------------------------------------------------------------
+/* Tick function event, draws the live projectiles */
+void FProjectileManagerInstanceTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && !Target->IsPendingKill())
+	{
+		Target->Update_InstancedRendering();
+	}
+}
+
+/* Tick function name for the diagnostics */
+FString FProjectileManagerInstanceTickFunction::DiagnosticMessage()
+{
+	return Target ? Target->GetFullName() + TEXT("[InstanceTick]") : TEXT("ProjectileManager[InstanceTick]");
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Base Class Engine Events										-
+//-----------------------------------------------------------------------------------
+/* Engine Begin play Event */
+void AProjectileManagerBase::BeginPlay()
+{
+	// create a pool per class, or allocate the simulation data. the instanced meshes exist before anything spawns. 
+	Create_SubPools();
+	Create_InstanceComponents();
+	ExpiryWheel.Reset(RetrieveReturnSettings.GetExpiryResolutionSeconds());
+
+	if (IsDataSimulationMode())
+	{
+		SimulationData.Initialize(GetInitProjectilePoolSize());
+	}
+	else
+	{
+		for (int32 ClassId = 0; ClassId < SubPools.Num(); ClassId++)
+		{
+			Create_ProjectilePool(ClassId, SubPools[ClassId].StartingPoolSize);
+		}
+	}
+
+	// the tick simulates the data, runs the managed collision, and finishes a time sliced pool. 
+	RefreshManagerTickEnabled();
+
+	// register the return pass. bStartWithTickEnabled is only read when an actor or component 
+	// registers its own tick functions, a raw tick function registers enabled, so turn it off here. 
+	ReturnTickFunction.Target = this;
+	ReturnTickFunction.RegisterTickFunction(GetLevel());
+	ReturnTickFunction.SetTickFunctionEnable(false);
+
+	// register the batched tick, the projectiles own ticks were turned off as they spawned. 
+	BatchTickFunction.Target = this;
+	BatchTickFunction.RegisterTickFunction(GetLevel());
+	BatchTickFunction.SetTickFunctionEnable(IsTickBatched());
+
+	// register the instanced mesh update, after the return pass so returned projectiles are not drawn. 
+	InstanceTickFunction.Target = this;
+	InstanceTickFunction.AddPrerequisite(this, ReturnTickFunction);
+	InstanceTickFunction.RegisterTickFunction(GetLevel());
+	InstanceTickFunction.SetTickFunctionEnable(IsRenderInstanced());
+
+	// let the function library find us without searching the world. 
+	if (UProjectileManagerSubsystem* Subsystem = UProjectileManagerSubsystem::Get(this))
+	{
+		Subsystem->Request_RegisterManager(this);
+	}
+
+	Super::BeginPlay();	
+}
+
+/* Engine Tick Event */
+void AProjectileManagerBase::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// apply what other threads reserved, returned or fired, every async wait time. 
+	if (GlobalSettings.AllowAnyAsyncRequests())
+	{
+		AsyncDrainTimer += DeltaTime;
+
+		if (AsyncDrainTimer >= GlobalSettings.GetAsyncWaitTime())
+		{
+			AsyncDrainTimer = 0.f;
+			Process_AsyncCommands();
+			Process_FireCommands();
+		}
+	}
+
+	// follow the demand before building, so a grow started now gets this frames budget. 
+	if (ShouldAutoscale())
+	{
+		Update_Autoscaling(DeltaTime);
+	}
+
+	// step far and old projectiles at a reduced rate, before anything moves this frame. 
+	if (ShouldEvaluateSignificance())
+	{
+		Update_Significance(DeltaTime);
+	}
+
+	// keep building a time sliced pool, what is built can already be used. 
+	if (IsCreatingPool())
+	{
+		Advance_PoolCreation();
+	}
+
+	// handle what last frames sweeps hit, before anything moves again. 
+	if (ShouldUseAsyncSweeps())
+	{
+		Consume_AsyncSweeps();
+	}
+
+	// move the actorless projectiles. 
+	if (IsDataSimulationMode())
+	{
+		Simulate_ProjectileData(DeltaTime);
+	}
+
+	// return what ran out of lifetime or range, in one batch. 
+	if (ExpiryWheel.Num() > 0)
+	{
+		Update_Expiry(DeltaTime);
+	}
+
+	// test where everything ended up against the registered targets. 
+	if (ShouldTestRegisteredTargets())
+	{
+		Test_RegisteredTargets();
+	}
+
+	// sweep the moves made since the last sweep. 
+	if (ShouldUseAsyncSweeps())
+	{
+		Issue_AsyncSweeps(DeltaTime);
+	}
+}
+
+/* Engine Endplay Event */
+void AProjectileManagerBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// stop being handed out before the pool goes away. 
+	if (UProjectileManagerSubsystem* Subsystem = UProjectileManagerSubsystem::Get(this))
+	{
+		Subsystem->Request_UnregisterManager(this);
+	}
+
+	// fire commands still buffered complete with no projectile, so nothing waits on them forever. 
+	FireCommandBuffer.TakePending(DrainedFireCommands);
+	for (const FProjectileFireCommand& Command : DrainedFireCommands)
+	{
+		if (Command.OnApplied) Command.OnApplied(FProjectileHandle(), nullptr);
+	}
+	DrainedFireCommands.Empty();
+
+	// async pulls and returns still queued are discarded, their slots go away with the pool and 
+	// a pull reserved now would never be applied. 
+	AsyncCommands.Empty();
+	PendingReturnHandles.Empty();
+
+	// stop the return pass and clean up the pool. 
+	ReturnTickFunction.UnRegisterTickFunction();
+	BatchTickFunction.UnRegisterTickFunction();
+	InstanceTickFunction.UnRegisterTickFunction();
+	CleanUp_ProjectilePool();
+	CleanUp_InstanceComponents();
+	SimulationData.Reset();
+	ExpiryWheel.Reset(RetrieveReturnSettings.GetExpiryResolutionSeconds());
+	PendingAsyncSweeps.Empty();
+	TargetHash.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Base Methods													-
+//-----------------------------------------------------------------------------------
+/*	Requests a pool resize 
+	@param: InNewProjectilePoolSize: The new pool size to try and set. 
+	@returns: if we were able to set the pool to the new size. 
+*/
+bool AProjectileManagerBase::Request_ResizeProjectilePool(int32& InNewProjectilePoolSize)
+{
+	return Resize_ProjectilePool(0, InNewProjectilePoolSize);
+}
+
+/*	Requests a resize of one classes pool, the other classes are left alone. 
+	@param: InClassId: The class id of the pool to resize. 
+	@param: InNewProjectilePoolSize: The new pool size to try and set. 
+	@returns: if we were able to set the pool to the new size. 
+*/
+bool AProjectileManagerBase::Request_ResizeProjectileSubPool(int32 InClassId, int32& InNewProjectilePoolSize)
+{
+	if (!IsValidClassId(InClassId))
+	{
+		UE_LOG(LogClass, Error, TEXT("Can not resize the pool of class id %d, the manager has %d projectile classes"), InClassId, SubPools.Num());
+		return false;
+	}
+
+	return Resize_ProjectilePool(InClassId, InNewProjectilePoolSize);
+}
+
+/*	Attempts to get a new projectile.
+@param: OutProjectileToUse: The pointer to the projectile as returned by reference.
+@returns: if we were able to get a projectile.
+*/
+bool AProjectileManagerBase::Request_GetProjectileFromManager(AManagedProjectileBase*& OutProjectileToUse, FProjectilePoolRequest& RetreieveSettings)
+{
+	FProjectileHandle IssuedHandle;
+	return Request_GetProjectileHandleFromManager(IssuedHandle, OutProjectileToUse, RetreieveSettings);
+}
+
+/*	Attempts to get a new projectile along with the handle issued for this use of it.
+@param: OutHandle: The handle issued for this use, pass it back to return the projectile.
+@param: OutProjectileToUse: The pointer to the projectile as returned by reference.
+@returns: if we were able to get a projectile.
+*/
+bool AProjectileManagerBase::Request_GetProjectileHandleFromManager(FProjectileHandle& OutHandle, AManagedProjectileBase*& OutProjectileToUse, FProjectilePoolRequest& RetreieveSettings)
+{
+	return Request_GetProjectileOfClassFromManager(0, OutHandle, OutProjectileToUse, RetreieveSettings);
+}
+
+/*	Attempts to get a new projectile of a class, from that classes own pool.
+@param: InClassId: The class id of the projectile wanted, see GetProjectileClassId.
+@param: OutHandle: The handle issued for this use, pass it back to return the projectile.
+@param: OutProjectileToUse: The pointer to the projectile as returned by reference.
+@returns: if we were able to get a projectile.
+*/
+bool AProjectileManagerBase::Request_GetProjectileOfClassFromManager(int32 InClassId, FProjectileHandle& OutHandle, AManagedProjectileBase*& OutProjectileToUse, FProjectilePoolRequest& RetreieveSettings)
+{
+	PROJECTILE_SCOPE_STAT(Acquire);
+
+	OutHandle.Reset();
+	OutProjectileToUse = nullptr;
+
+	if (!IsValidClassId(InClassId) || IsDataSimulationMode())
+	{
+		UE_LOG(LogClass, Error, TEXT("Class id %d is not an actor pool of this manager"), InClassId);
+		return false;
+	}
+
+	FManagedProjectileSubPool& Pool = SubPools[InClassId];
+
+	if (Pool.GetActorPoolSize() <= 0 && !AutoscaleSettings.ShouldGrowOnExhaustion())
+	{
+		Pool.Telemetry.AcquireFailures++;
+		PROJECTILE_COUNT_STAT(AcquireFailures, 1);
+		UE_LOG(LogClass, Error, TEXT("Current pool size is 0; cant pull any projectiles out of it%s"), Pool.IsCreating() ? TEXT(", the pool is still being created") : TEXT(""));
+		return false;
+	}
+	else
+	{
+		// pop the next free entry, an empty pool can grow on the spot when autoscaling. 
+		int32 found = Pool.PopFreeEntry();
+		if (found < 0)
+		{
+			Pool.Telemetry.AcquireMisses++;
+			PROJECTILE_COUNT_STAT(AcquireMisses, 1);
+			if (Grow_OnExhaustion(InClassId, 1) > 0) found = Pool.PopFreeEntry();
+		}
+
+		// if the entry is valid. 
+		if (found >= 0)
+		{
+			// mark it as being used with a fresh generation, the projectile keeps the handle to speed up the return.
+			OutProjectileToUse = AcquireEntry(InClassId, found, OutHandle);
+
+			// apply the pull settings and return. 
+			return ApplyPullRequest(InClassId, found, RetreieveSettings);
+		}
+		else
+		{
+			Pool.Telemetry.AcquireFailures++;
+			PROJECTILE_COUNT_STAT(AcquireFailures, 1);
+			UE_LOG(LogClass, Error, TEXT("Could not find a projectile to return, try making your pool bigger."));
+			return false;
+		}
+	}
+}
+
+/*	Attempts to get a burst of projectiles in one operation, one per request. 
+	@param: OutProjectilesToUse: The projectiles pulled for the burst, in request order.
+	@param: OutHandles: The handles issued for each projectile, in request order.
+	@param: RetreieveSettings: The pull settings, one per projectile wanted.
+	@returns: if the whole burst was pulled, a partial burst is still handed out.
+*/
+bool AProjectileManagerBase::Request_GetProjectileBurstFromManager(TArray<AManagedProjectileBase*>& OutProjectilesToUse, TArray<FProjectileHandle>& OutHandles, const TArray<FProjectilePoolRequest>& RetreieveSettings)
+{
+	return Request_GetProjectileBurstOfClassFromManager(0, OutProjectilesToUse, OutHandles, RetreieveSettings);
+}
+
+/*	Attempts to get a burst of projectiles of one class in one operation, one per request. 
+	@param: InClassId: The class id of the projectiles wanted.
+	@param: OutProjectilesToUse: The projectiles pulled for the burst, in request order.
+	@param: OutHandles: The handles issued for each projectile, in request order.
+	@param: RetreieveSettings: The pull settings, one per projectile wanted.
+	@returns: if the whole burst was pulled, a partial burst is still handed out.
+*/
+bool AProjectileManagerBase::Request_GetProjectileBurstOfClassFromManager(int32 InClassId, TArray<AManagedProjectileBase*>& OutProjectilesToUse, TArray<FProjectileHandle>& OutHandles, const TArray<FProjectilePoolRequest>& RetreieveSettings)
+{
+	return Request_GenerateProjectileBurstFromManager(RetreieveSettings.Num(), [&RetreieveSettings](int32 Index, FProjectilePoolRequest& OutRequest) { OutRequest = RetreieveSettings[Index]; }, OutProjectilesToUse, OutHandles, InClassId);
+}
+
+/*	Attempts to get a burst of projectiles in one operation, the slots are reserved up front. 
+	@param: InBurstCount: The number of projectiles wanted.
+	@param: RequestGenerator: Fills in the pull settings for each index of the burst.
+	@param: OutProjectilesToUse: The projectiles pulled for the burst, in burst order.
+	@param: OutHandles: The handles issued for each projectile, in burst order.
+	@param: InClassId: The class id of the projectiles wanted.
+	@returns: if the whole burst was pulled, a partial burst is still handed out.
+*/
+bool AProjectileManagerBase::Request_GenerateProjectileBurstFromManager(int32 InBurstCount, TFunctionRef<void(int32, FProjectilePoolRequest&)> RequestGenerator, TArray<AManagedProjectileBase*>& OutProjectilesToUse, TArray<FProjectileHandle>& OutHandles, int32 InClassId)
+{
+	PROJECTILE_SCOPE_STAT(AcquireBurst);
+
+	OutProjectilesToUse.Reset();
+	OutHandles.Reset();
+
+	if (InBurstCount <= 0) return false;
+	else if (!IsValidClassId(InClassId) || IsDataSimulationMode())
+	{
+		UE_LOG(LogClass, Error, TEXT("Class id %d is not an actor pool of this manager"), InClassId);
+		return false;
+	}
+
+	FManagedProjectileSubPool& Pool = SubPools[InClassId];
+
+	if (Pool.GetActorPoolSize() <= 0 && !AutoscaleSettings.ShouldGrowOnExhaustion())
+	{
+		Pool.Telemetry.AcquireFailures++;
+		PROJECTILE_COUNT_STAT(AcquireFailures, 1);
+		UE_LOG(LogClass, Error, TEXT("Current pool size is 0; cant pull any projectiles out of it%s"), Pool.IsCreating() ? TEXT(", the pool is still being created") : TEXT(""));
+		return false;
+	}
+	else
+	{
+		// reserve every slot for the burst in one go. 
+		TArray<int32> Reserved;
+		int32 NumReserved = Pool.PopFreeEntries(InBurstCount, Reserved);
+
+		// grow for the rest of the burst when autoscaling. 
+		if (NumReserved < InBurstCount)
+		{
+			Pool.Telemetry.AcquireMisses++;
+			PROJECTILE_COUNT_STAT(AcquireMisses, 1);
+			if (Grow_OnExhaustion(InClassId, InBurstCount - NumReserved) > 0)
+			{
+				NumReserved += Pool.PopFreeEntries(InBurstCount - NumReserved, Reserved);
+			}
+		}
+
+		OutProjectilesToUse.Reserve(NumReserved);
+		OutHandles.Reserve(NumReserved);
+
+		// apply the pull settings to each reserved projectile. 
+		FProjectilePoolRequest Request;
+		for (int32 i = 0; i < NumReserved; i++)
+		{
+			FProjectileHandle IssuedHandle;
+			AManagedProjectileBase* Projectile = AcquireEntry(InClassId, Reserved[i], IssuedHandle);
+
+			RequestGenerator(i, Request);
+			ApplyPullRequest(InClassId, Reserved[i], Request);
+
+			OutProjectilesToUse.Add(Projectile);
+			OutHandles.Add(IssuedHandle);
+		}
+
+		if (NumReserved < InBurstCount)
+		{
+			Pool.Telemetry.AcquireFailures++;
+			PROJECTILE_COUNT_STAT(AcquireFailures, 1);
+			UE_LOG(LogClass, Error, TEXT("Could only pull %d of the %d projectiles in the burst, try making your pool bigger."), NumReserved, InBurstCount);
+			return false;
+		}
+
+		return true;
+	}
+}
+
+/*	Attempts to return a projectile to the pool. 
+	@param: InProjectileToReturn: The pointer to the projectile to return. 
+	@returns: if we were able to return the projectile. 
+*/
+bool AProjectileManagerBase::Request_ReturnProjectileToManager(AManagedProjectileBase*& InProjectileToReturn)
+{
+	PROJECTILE_SCOPE_STAT(Return);
+
+	if (!InProjectileToReturn)
+	{
+		UE_LOG(LogClass, Error, TEXT("Attempted to return nullptr to pool"));
+		return false;
+	}
+	else
+	{
+		// the projectile carries the handle it was issued with, resolve that directly. 
+		const FProjectileHandle Handle = InProjectileToReturn->GetPoolHandle();
+		int32 found = ResolveHandle(Handle);
+
+		if (found >= 0 && SubPools[Handle.GetPoolIndex()].Entries[found].IsEntry(InProjectileToReturn))
+		{
+			return ShouldDeferReturns() ? QueueEntryForReturn(Handle.GetPoolIndex(), found) : ReturnEntryToPool(Handle.GetPoolIndex(), found);
+		}
+		else
+		{
+			PROJECTILE_COUNT_STAT(ReturnMisses, 1);
+			UE_LOG(LogClass, Error, TEXT("Inputed object to return to the pool does not exist as an entry in the managed pool, or was already returned"));
+			return false;
+		}
+	}
+}
+
+/*	Attempts to return a projectile to the pool by the handle it was issued with. 
+	@param: InHandle: The handle issued when the projectile was pulled from the pool. 
+	@returns: if we were able to return the projectile, false for stale or double returns. 
+*/
+bool AProjectileManagerBase::Request_ReturnProjectileHandleToManager(const FProjectileHandle& InHandle)
+{
+	PROJECTILE_SCOPE_STAT(Return);
+
+	int32 found = ResolveHandle(InHandle);
+
+	if (found >= 0)
+	{
+		return ShouldDeferReturns() ? QueueEntryForReturn(InHandle.GetPoolIndex(), found) : ReturnEntryToPool(InHandle.GetPoolIndex(), found);
+	}
+	else
+	{
+		PROJECTILE_COUNT_STAT(ReturnMisses, 1);
+		UE_LOG(LogClass, Error, TEXT("Inputed handle to return to the pool is stale or was never issued by this manager"));
+		return false;
+	}
+}
+
+/* Is the handle still the current use of its projectile? */
+bool AProjectileManagerBase::IsProjectileHandleAlive(const FProjectileHandle& InHandle) const
+{
+	return ResolveHandle(InHandle) >= 0;
+}
+
+/* Gets the projectile a handle points at, nullptr if the handle is stale. */
+AManagedProjectileBase* AProjectileManagerBase::GetProjectileFromHandle(const FProjectileHandle& InHandle) const
+{
+	int32 found = ResolveHandle(InHandle);
+	return found >= 0 ? SubPools[InHandle.GetPoolIndex()].Entries[found].GetManagedProjectilePtr() : nullptr;
+}
+
+/*	Reserves a projectile from any thread. Only the slot is taken here, the handle is issued 
+	now but goes live once the game thread applies the pull on the next manager tick, when the 
+	acquired event is raised. The pool never grows off thread. 
+	@param: InClassId: The class id of the projectile wanted.
+	@param: InRetreieveSettings: The pull settings, applied on the game thread.
+	@param: OutHandle: The handle the projectile will be issued with.
+	@returns: if a slot was reserved.
+*/
+bool AProjectileManagerBase::Request_GetProjectileAsync(int32 InClassId, const FProjectilePoolRequest& InRetreieveSettings, FProjectileHandle& OutHandle)
+{
+	OutHandle.Reset();
+
+	if (!GlobalSettings.AllowAsyncPullFromPool() || IsDataSimulationMode())
+	{
+		UE_LOG(LogClass, Error, TEXT("Async pulls are not allowed by this manager, or it is in the data simulation mode"));
+		return false;
+	}
+
+	FRWScopeLock ReadLock(PoolLock, SLT_ReadOnly);
+
+	if (!IsValidClassId(InClassId)) return false;
+
+	FManagedProjectileSubPool& Pool = SubPools[InClassId];
+	const int32 Slot = Pool.PopFreeEntry();
+	if (Slot == INDEX_NONE) return false;
+
+	// the pop reserved the slot for this thread alone, so its generation can be read straight off. 
+	OutHandle = FProjectileHandle(Slot, Pool.GetEntryGeneration(Slot), InClassId);
+	AsyncCommands.Enqueue(FProjectileAsyncCommand(OutHandle, InRetreieveSettings, false));
+	return true;
+}
+
+/*	Returns a projectile from any thread, the return is made on the game thread on the next 
+	manager tick, where stale and double returns are dropped. 
+	@param: InHandle: The handle issued for the projectile.
+	@returns: if the return was queued.
+*/
+bool AProjectileManagerBase::Request_ReturnProjectileAsync(const FProjectileHandle& InHandle)
+{
+	if (!GlobalSettings.AllowAsyncReturnToPool() || !InHandle.IsSet())
+	{
+		UE_LOG(LogClass, Error, TEXT("Async returns are not allowed by this manager, or the handle was never issued"));
+		return false;
+	}
+
+	AsyncCommands.Enqueue(FProjectileAsyncCommand(InHandle, FProjectilePoolRequest(), true));
+	return true;
+}
+
+/*	Appends a fire command from any thread, it is applied with the rest of the buffer on the 
+	game thread every async wait time. 
+	@param: InCommand: The compact fire request, its callback is called on the game thread.
+	@returns: if the command was buffered.
+*/
+bool AProjectileManagerBase::Request_EnqueueFire(FProjectileFireCommand InCommand)
+{
+	if (!GlobalSettings.AllowAsyncPullFromPool())
+	{
+		UE_LOG(LogClass, Error, TEXT("Fire commands are async pulls, they are not allowed by this manager"));
+		return false;
+	}
+
+	FireCommandBuffer.Append(MoveTemp(InCommand));
+	return true;
+}
+
+/*	Appends a batch of fire commands from any thread under one lock. 
+	@param: InOutCommands: The compact fire requests, left empty once buffered.
+	@returns: if the commands were buffered.
+*/
+bool AProjectileManagerBase::Request_EnqueueFireBatch(TArray<FProjectileFireCommand>& InOutCommands)
+{
+	if (!GlobalSettings.AllowAsyncPullFromPool())
+	{
+		UE_LOG(LogClass, Error, TEXT("Fire commands are async pulls, they are not allowed by this manager"));
+		return false;
+	}
+
+	FireCommandBuffer.Append(InOutCommands);
+	return true;
+}
+
+/*	Appends a fire command from any thread and hands back a future for its handle. The future 
+	is always set, with an unset handle if nothing was fired or the manager stopped playing. 
+	@param: InCommand: The compact fire request, its own callback is replaced.
+	@returns: the future set with the issued handle.
+*/
+TFuture<FProjectileHandle> AProjectileManagerBase::Request_EnqueueFireWithFuture(FProjectileFireCommand InCommand)
+{
+	TSharedRef<TPromise<FProjectileHandle>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<FProjectileHandle>, ESPMode::ThreadSafe>();
+	TFuture<FProjectileHandle> Future = Promise->GetFuture();
+
+	InCommand.OnApplied = [Promise](const FProjectileHandle& InHandle, AManagedProjectileBase*) { Promise->SetValue(InHandle); };
+
+	if (!Request_EnqueueFire(MoveTemp(InCommand)))
+	{
+		Promise->SetValue(FProjectileHandle());
+	}
+
+	return Future;
+}
+
+/*	Registers an actor projectiles are bucketed by their distance to, in place of the players. 
+	@param: InViewpoint: The actor to add.
+	@returns: if the actor was added.
+*/
+bool AProjectileManagerBase::Request_RegisterSignificanceViewpoint(AActor* InViewpoint)
+{
+	if (!InViewpoint || SignificanceViewpoints.Contains(InViewpoint)) return false;
+
+	SignificanceViewpoints.Add(InViewpoint);
+	return true;
+}
+
+/*	Unregisters a significance viewpoint, the players are used again once none are left. 
+	@param: InViewpoint: The actor to remove.
+	@returns: if the actor was registered.
+*/
+bool AProjectileManagerBase::Request_UnregisterSignificanceViewpoint(AActor* InViewpoint)
+{
+	return SignificanceViewpoints.Remove(InViewpoint) > 0;
+}
+
+/*	Gets the class id of a projectile class, used to pull from that classes pool. 
+	@param: InProjectileClass: The projectile class.
+	@returns: the class id, INDEX_NONE if the class is not pooled by this manager.
+*/
+int32 AProjectileManagerBase::GetProjectileClassId(TSubclassOf<AManagedProjectileBase> InProjectileClass) const
+{
+	const int32* ClassId = ClassIdsByClass.Find(InProjectileClass.Get());
+	return ClassId ? *ClassId : INDEX_NONE;
+}
+
+/* Processes every queued return in one pass, the projectiles are parked in bulk. */
+void AProjectileManagerBase::ProcessPendingReturns()
+{
+	PROJECTILE_SCOPE_STAT(ReturnPass);
+
+	// take the queue, parking a projectile can fire overlaps that queue more returns. 
+	TArray<FProjectileHandle> ReturnsThisPass = MoveTemp(PendingReturnHandles);
+	PendingReturnHandles.Reset();
+	ReturnTickFunction.SetTickFunctionEnable(false);
+
+	for (const FProjectileHandle& Handle : ReturnsThisPass)
+	{
+		// the entry can only be queued once per use, but make sure it wasnt handled since. 
+		const int32 EntryIndex = ResolveHandle(Handle);
+		if (EntryIndex >= 0 && SubPools[Handle.GetPoolIndex()].Entries[EntryIndex].IsPendingReturn())
+		{
+			SubPools[Handle.GetPoolIndex()].Entries[EntryIndex].MarkPendingReturn(false);
+			ReturnEntryToPool(Handle.GetPoolIndex(), EntryIndex);
+		}
+	}
+}
+
+/* Applies the pulls and returns requested off the game thread in the order they were made. */
+void AProjectileManagerBase::Process_AsyncCommands()
+{
+	PROJECTILE_SCOPE_STAT(AsyncCommands);
+
+	FProjectileAsyncCommand Command;
+	while (AsyncCommands.Dequeue(Command))
+	{
+		const FProjectileHandle& Handle = Command.ProjectileHandle;
+
+		if (Command.bIsReturn)
+		{
+			Return_ProjectileByHandle(Handle);
+		}
+		else if (IsValidClassId(Handle.GetPoolIndex()) && SubPools[Handle.GetPoolIndex()].CommitReservedEntry(Handle))
+		{
+			// the reserved entry has waited untouched, apply the pull as the game thread would. 
+			AManagedProjectileBase* Projectile = SubPools[Handle.GetPoolIndex()].Entries[Handle.GetSlotIndex()].MarkEntryInUse(Handle);
+			ApplyPullRequest(Handle.GetPoolIndex(), Handle.GetSlotIndex(), Command.PullRequest);
+			PROJECTILE_COUNT_STAT(Acquires, 1);
+			Report_PoolOccupancy();
+			OnAsyncProjectileAcquired.Broadcast(Handle, Projectile);
+		}
+		else
+		{
+			// the reservation was lost to a clean up or a resize since it was made, drop the pull. 
+			UE_LOG(LogClass, Warning, TEXT("Dropped a stale async pull for slot %d of class id %d, its reservation no longer holds"), Handle.GetSlotIndex(), Handle.GetPoolIndex());
+		}
+	}
+}
+
+/*	Applies every buffered fire command in one pass. The actor pool sorts them by class and pulls 
+	each class as one burst, so a class is popped, grown and logged once however many shots it 
+	has. Each command is then completed in the order it was appended within its class. 
+*/
+void AProjectileManagerBase::Process_FireCommands()
+{
+	PROJECTILE_SCOPE_STAT(FireCommands);
+
+	// the scratch arrays are taken into locals for the pass, a callback can fire another burst or 
+	// drain the buffer again and would otherwise overwrite them under this loop. 
+	TArray<FProjectileFireCommand> Commands = MoveTemp(DrainedFireCommands);
+	TArray<AManagedProjectileBase*> Projectiles = MoveTemp(FiredProjectiles);
+	TArray<FProjectileHandle> Handles = MoveTemp(FiredHandles);
+
+	if (FireCommandBuffer.TakePending(Commands) <= 0)
+	{
+		Restore_FireScratch(Commands, Projectiles, Handles);
+		return;
+	}
+
+	if (IsDataSimulationMode())
+	{
+		for (const FProjectileFireCommand& Command : Commands)
+		{
+			FProjectileHandle Handle;
+			Request_FireSimulatedProjectile(Handle, Command.ToPoolRequest());
+			if (Command.OnApplied) Command.OnApplied(Handle, nullptr);
+		}
+	}
+	else
+	{
+		Commands.StableSort([](const FProjectileFireCommand& A, const FProjectileFireCommand& B) { return A.ClassId < B.ClassId; });
+
+		for (int32 RunStart = 0; RunStart < Commands.Num();)
+		{
+			// find the run of commands for this class. 
+			const int32 ClassId = Commands[RunStart].ClassId;
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < Commands.Num() && Commands[RunEnd].ClassId == ClassId) RunEnd++;
+
+			Request_GenerateProjectileBurstFromManager(RunEnd - RunStart, [&Commands, RunStart](int32 Index, FProjectilePoolRequest& OutRequest) { OutRequest = Commands[RunStart + Index].ToPoolRequest(); }, Projectiles, Handles, ClassId);
+
+			// a partial burst fires the first commands of the run, the rest complete unset. 
+			for (int32 i = RunStart; i < RunEnd; i++)
+			{
+				const int32 BurstIndex = i - RunStart;
+				const FOnProjectileFireCommandApplied& OnApplied = Commands[i].OnApplied;
+
+				if (OnApplied)
+				{
+					OnApplied(Handles.IsValidIndex(BurstIndex) ? Handles[BurstIndex] : FProjectileHandle(), Projectiles.IsValidIndex(BurstIndex) ? Projectiles[BurstIndex] : nullptr);
+				}
+			}
+
+			RunStart = RunEnd;
+		}
+	}
+
+	Restore_FireScratch(Commands, Projectiles, Handles);
+}
+
+/*	Hands the fire pass scratch arrays back to the manager so their allocations are reused next 
+	pass. A re-entrant pass that already handed its own back keeps them, these are freed instead. 
+	@param: InCommands: The drained commands of the pass.
+	@param: InProjectiles: The burst projectiles of the pass.
+	@param: InHandles: The burst handles of the pass.
+*/
+void AProjectileManagerBase::Restore_FireScratch(TArray<FProjectileFireCommand>& InCommands, TArray<AManagedProjectileBase*>& InProjectiles, TArray<FProjectileHandle>& InHandles)
+{
+	InCommands.Reset();
+	InProjectiles.Reset();
+	InHandles.Reset();
+
+	if (DrainedFireCommands.Max() <= 0) DrainedFireCommands = MoveTemp(InCommands);
+	if (FiredProjectiles.Max() <= 0) FiredProjectiles = MoveTemp(InProjectiles);
+	if (FiredHandles.Max() <= 0) FiredHandles = MoveTemp(InHandles);
+}
+
+/*	Moves every live projectile in pool order, one dispatch for the whole pool instead of an 
+	actor and a component tick per projectile. A hit can return or pull projectiles mid pass, 
+	so the pools are indexed and their sizes re-read every step. 
+	@param: DeltaTime: The frame time.
+*/
+void AProjectileManagerBase::Tick_BatchedProjectiles(float DeltaTime)
+{
+	PROJECTILE_SCOPE_STAT(BatchedTick);
+
+	int32 StepsSkipped = 0;
+
+	for (int32 ClassId = 0; ClassId < SubPools.Num(); ClassId++)
+	{
+		for (int32 i = 0; i < SubPools[ClassId].Entries.Num(); i++)
+		{
+			AManagedProjectileBase* Projectile = nullptr;
+			int32 SignificanceBucket = INDEX_NONE;
+			{
+				const FManagedProjectileEntry& Entry = SubPools[ClassId].Entries[i];
+				if (!SubPools[ClassId].IsEntryInUse(i) || Entry.IsPendingReturn()) continue;
+
+				Projectile = Entry.GetManagedProjectilePtr();
+				SignificanceBucket = Entry.SignificanceBucket;
+			}
+
+			// the step can grow or trim the entries, nothing may read them across it. 
+			if (Projectile && !Projectile->Tick_Batched(DeltaTime) && SignificanceBucket != INDEX_NONE) StepsSkipped++;
+		}
+	}
+
+	SignificanceStats.BatchedStepsSkipped = StepsSkipped;
+}
+
+/*	Writes the live projectiles of each instanced class into its instanced mesh in one batched 
+	update. The instances are reused from the front every frame, instances no longer needed 
+	are hidden by scaling them to nothing rather than removed, so the instance buffer only 
+	grows and a return never reorders it. Only instances that showed a projectile last frame 
+	are hidden, the rest already are. 
+*/
+void AProjectileManagerBase::Update_InstancedRendering()
+{
+	PROJECTILE_SCOPE_STAT(InstanceUpdate);
+
+	const FTransform HiddenInstance(FQuat::Identity, GetPoolLocation(), FVector::ZeroVector);
+	int32 NumRenderedInstances = 0;
+
+	for (FManagedProjectileSubPool& Pool : SubPools)
+	{
+		if (!Pool.IsRenderInstanced()) continue;
+
+		const double StartTime = FPlatformTime::Seconds();
+		UInstancedStaticMeshComponent* InstanceComponent = Pool.InstanceComponent;
+
+		// gather the live transforms in pool order. 
+		Pool.InstanceTransforms.Reset();
+		for (int32 i = 0; i < Pool.Entries.Num(); i++)
+		{
+			const FManagedProjectileEntry& Entry = Pool.Entries[i];
+			if (!Pool.IsEntryInUse(i) || Entry.IsPendingReturn()) continue;
+
+			if (AManagedProjectileBase* Projectile = Entry.GetManagedProjectilePtr())
+			{
+				Pool.InstanceTransforms.Add(Projectile->GetActorTransform());
+			}
+		}
+
+		const int32 NumLive = Pool.InstanceTransforms.Num();
+		const int32 NumInstances = InstanceComponent->GetInstanceCount();
+
+		// hide what was drawn last frame and is not live now. 
+		for (int32 i = NumLive; i < FMath::Min(Pool.NumRenderedInstances, NumInstances); i++)
+		{
+			Pool.InstanceTransforms.Add(HiddenInstance);
+		}
+
+		// grow the instances for the live projectiles past the end, then update the rest in one go. 
+		if (NumLive > NumInstances)
+		{
+			TArray<FTransform> NewInstances(Pool.InstanceTransforms.GetData() + NumInstances, NumLive - NumInstances);
+			InstanceComponent->AddInstances(NewInstances, false);
+			Pool.InstanceTransforms.SetNum(NumInstances, false);
+		}
+
+		if (Pool.InstanceTransforms.Num() > 0)
+		{
+			InstanceComponent->BatchUpdateInstancesTransforms(0, Pool.InstanceTransforms, false, true, true);
+		}
+
+		Pool.NumRenderedInstances = NumLive;
+		NumRenderedInstances += NumLive;
+		Pool.Telemetry.RenderedInstances = NumLive;
+		Pool.Telemetry.InstanceUpdateMilliseconds = float((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	PROJECTILE_SET_STAT(RenderedInstances, NumRenderedInstances);
+}
+
+/* Returns the current managed pool size, every class together. */
+int32 AProjectileManagerBase::GetCurrentPoolSize() const
+{
+	if (IsDataSimulationMode()) return SimulationData.GetCapacity();
+
+	int32 Total = 0;
+	for (const FManagedProjectileSubPool& Pool : SubPools)
+	{
+		Total += Pool.GetActorPoolSize();
+	}
+
+	return Total;
+}
+
+/*	Gets the pool size of one class. 
+	@param: InClassId: The class id.
+	@returns: the pool size, 0 for an unknown class id.
+*/
+int32 AProjectileManagerBase::GetSubPoolSize(int32 InClassId) const
+{
+	return IsValidClassId(InClassId) ? GetPoolSizeOf(InClassId) : 0;
+}
+
+/* Is any class still having its pool created over several frames? */
+bool AProjectileManagerBase::IsCreatingPool() const
+{
+	for (const FManagedProjectileSubPool& Pool : SubPools)
+	{
+		if (Pool.IsCreating()) return true;
+	}
+
+	return false;
+}
+
+/*	Gets the usage telemetry of one classes pool. 
+	@param: InClassId: The class id, 0 in the data simulation mode.
+	@returns: the telemetry, empty for an unknown class id.
+*/
+FProjectilePoolTelemetry AProjectileManagerBase::GetPoolTelemetry(int32 InClassId) const
+{
+	return IsValidClassId(InClassId) ? SubPools[InClassId].Telemetry : FProjectilePoolTelemetry();
+}
+
+/*	Gets the number of projectiles currently handed out. 
+	@returns: the live simulated projectiles in the data mode, otherwise the pool entries in use of every class.
+*/
+int32 AProjectileManagerBase::GetInUseCount() const
+{
+	if (IsDataSimulationMode()) return SimulationData.Num();
+
+	int32 Total = 0;
+	for (const FManagedProjectileSubPool& Pool : SubPools)
+	{
+		Total += Pool.GetInUseCount();
+	}
+
+	return Total;
+}
+
+/*	Gets how far along the time sliced pool creations are, every class together. 
+	@returns: 0 to 1, 1 when no creation is running.
+*/
+float AProjectileManagerBase::GetPoolCreationProgress() const
+{
+	int32 NumCreated = 0;
+	int32 NumToCreate = 0;
+
+	for (const FManagedProjectileSubPool& Pool : SubPools)
+	{
+		if (!Pool.IsCreating()) continue;
+
+		NumCreated += Pool.GetActorPoolSize() - Pool.CreationStartSize;
+		NumToCreate += Pool.PendingCreationTarget - Pool.CreationStartSize;
+	}
+
+	return NumToCreate > 0 ? FMath::Clamp(float(NumCreated) / float(NumToCreate), 0.f, 1.f) : 1.f;
+}
+
+/*	Fires an actorless projectile in the data simulation mode. 
+	@param: OutHandle: The handle issued for the projectile, pass it back to return it.
+	@param: FireSettings: The location, direction, speed, collision and owner to fire with.
+	@returns: if the projectile was fired.
+*/
+bool AProjectileManagerBase::Request_FireSimulatedProjectile(FProjectileHandle& OutHandle, const FProjectilePoolRequest& FireSettings)
+{
+	if (!IsDataSimulationMode())
+	{
+		UE_LOG(LogClass, Error, TEXT("Simulated projectiles can only be fired from a manager in the data simulation pool mode"));
+		OutHandle.Reset();
+		return false;
+	}
+	else if (!SimulationData.HasFreeSlot() && Grow_OnExhaustion(0, 1) <= 0)
+	{
+		if (IsValidClassId(0)) SubPools[0].Telemetry.AcquireFailures++;
+		PROJECTILE_COUNT_STAT(AcquireFailures, 1);
+		UE_LOG(LogClass, Error, TEXT("Could not find a simulated projectile slot, try making your pool bigger."));
+		OutHandle.Reset();
+		return false;
+	}
+	else if (SimulationData.Add(FireSettings, SimulationSettings.GetCollisionRadius(), OutHandle))
+	{
+		Schedule_Expiry(OutHandle, FireSettings, SimulationSettings.GetMaxLifetime());
+		PROJECTILE_COUNT_STAT(Acquires, 1);
+		Report_PoolOccupancy();
+		return true;
+	}
+
+	return false;
+}
+
+/*	Returns an actorless projectile, freeing its slot. 
+	@param: InHandle: The handle issued when the projectile was fired.
+	@returns: if the projectile was returned, false for stale or double returns.
+*/
+bool AProjectileManagerBase::Request_ReturnSimulatedProjectile(const FProjectileHandle& InHandle)
+{
+	const int32 DenseIndex = SimulationData.ResolveHandle(InHandle);
+
+	if (DenseIndex < 0)
+	{
+		UE_LOG(LogClass, Error, TEXT("Inputed handle to return is stale or was never issued by this manager"));
+		return false;
+	}
+	else
+	{
+		Return_SimulatedProjectileAt(DenseIndex);
+		return true;
+	}
+}
+
+/*	Gets the current state of an actorless projectile. 
+	@param: InHandle: The handle issued when the projectile was fired.
+	@param: OutLocation: The current location.
+	@param: OutVelocity: The current velocity.
+	@returns: if the handle is still alive.
+*/
+bool AProjectileManagerBase::GetSimulatedProjectileState(const FProjectileHandle& InHandle, FVector& OutLocation, FVector& OutVelocity) const
+{
+	const int32 DenseIndex = SimulationData.ResolveHandle(InHandle);
+
+	if (DenseIndex < 0) return false;
+	else
+	{
+		OutLocation = SimulationData.GetPosition(DenseIndex);
+		OutVelocity = SimulationData.GetVelocity(DenseIndex);
+		return true;
+	}
+}
+
+/* Returns the number of live actorless projectiles. */
+int32 AProjectileManagerBase::GetSimulatedProjectileCount() const
+{
+	return SimulationData.Num();
+}
+
+/*	Registers a target the projectiles are tested against, hits raise the target hit event. 
+	@param: InDescription: The shape, size and position of the target.
+	@returns: the id of the target, or INDEX_NONE if target testing is off.
+*/
+int32 AProjectileManagerBase::Request_RegisterProjectileTarget(const FProjectileTargetDescription& InDescription)
+{
+	return Request_RegisterProjectileTargetWithCallback(InDescription, FOnProjectileTargetTouched());
+}
+
+/*	Registers a target with a callback of its own. 
+	@param: InDescription: The shape, size and position of the target.
+	@param: InCallback: Called when a projectile touches this target.
+	@returns: the id of the target, or INDEX_NONE if target testing is off.
+*/
+int32 AProjectileManagerBase::Request_RegisterProjectileTargetWithCallback(const FProjectileTargetDescription& InDescription, const FOnProjectileTargetTouched& InCallback)
+{
+	if (!ShouldTestRegisteredTargets())
+	{
+		UE_LOG(LogClass, Error, TEXT("Projectile Manager is not set to test registered targets, enable bTestRegisteredTargets in the collision settings"));
+		return INDEX_NONE;
+	}
+	else
+	{
+		return TargetHash.AddTarget(InDescription, InCallback);
+	}
+}
+
+/*	Removes a registered target. 
+	@param: InTargetId: The id returned on registration.
+	@returns: if the target was registered.
+*/
+bool AProjectileManagerBase::Request_UnregisterProjectileTarget(int32 InTargetId)
+{
+	return TargetHash.RemoveTarget(InTargetId);
+}
+
+/*	Moves a registered target that does not follow an actor. 
+	@param: InTargetId: The id returned on registration.
+	@param: InNewCenter: The new center of the target.
+	@returns: if the target was registered.
+*/
+bool AProjectileManagerBase::Request_MoveProjectileTarget(int32 InTargetId, FVector InNewCenter)
+{
+	return TargetHash.SetTargetCenter(InTargetId, InNewCenter);
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Base Class Internal Methods									-
+//-----------------------------------------------------------------------------------
+/*	Creates an empty pool per projectile class. The class to use is always class id 0, the 
+	additional classes follow in order. The data simulation mode only has class id 0. 
+*/
+void AProjectileManagerBase::Create_SubPools()
+{
+	FRWScopeLock WriteLock(PoolLock, SLT_Write);
+
+	SubPools.Reset();
+	ClassIdsByClass.Reset();
+
+	SubPools.Emplace(GetProjectileClassToUse(), GetInitProjectilePoolSize());
+	SubPools[0].InstanceMesh = InitSettings.GetInstanceMesh();
+	ClassIdsByClass.Add(GetProjectileClassToUse(), 0);
+
+	if (IsDataSimulationMode()) return;
+
+	for (const FProjectileSubPoolSettings& SubPoolSettings : InitSettings.GetAdditionalProjectileClasses())
+	{
+		UClass* ProjectileClass = SubPoolSettings.GetProjectileClass();
+
+		if (!ProjectileClass || ClassIdsByClass.Contains(ProjectileClass))
+		{
+			UE_LOG(LogClass, Error, TEXT("Skipping additional projectile class %s, it is unset or already pooled by this manager"), *GetNameSafe(ProjectileClass));
+			continue;
+		}
+
+		const int32 ClassId = SubPools.Emplace(ProjectileClass, SubPoolSettings.GetStartingPoolSize());
+		SubPools[ClassId].InstanceMesh = SubPoolSettings.GetInstanceMesh();
+		ClassIdsByClass.Add(ProjectileClass, ClassId);
+	}
+}
+
+/*	Creates an instanced mesh for each sub pool with a mesh to draw, in the instanced mesh 
+	render mode. The components sit at the world origin, so the instances are in world space. 
+	A class without a mesh keeps drawing its own actors. 
+*/
+void AProjectileManagerBase::Create_InstanceComponents()
+{
+	if (!IsRenderInstanced()) return;
+
+	for (int32 ClassId = 0; ClassId < SubPools.Num(); ClassId++)
+	{
+		FManagedProjectileSubPool& Pool = SubPools[ClassId];
+
+		if (!Pool.InstanceMesh)
+		{
+			UE_LOG(LogClass, Warning, TEXT("Projectile class %s has no instance mesh, its actors draw themselves"), *GetNameSafe(Pool.GetProjectileClass()));
+			continue;
+		}
+
+		UInstancedStaticMeshComponent* InstanceComponent = NewObject<UInstancedStaticMeshComponent>(this);
+		InstanceComponent->SetStaticMesh(Pool.InstanceMesh);
+		InstanceComponent->SetMobility(EComponentMobility::Movable);
+		InstanceComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		InstanceComponent->SetCanEverAffectNavigation(false);
+		InstanceComponent->SetAbsolute(true, true, true);
+		InstanceComponent->SetWorldTransform(FTransform::Identity);
+		InstanceComponent->RegisterComponent();
+
+		Pool.InstanceComponent = InstanceComponent;
+		Pool.NumRenderedInstances = 0;
+	}
+}
+
+/* Destroys the instanced meshes. */
+void AProjectileManagerBase::CleanUp_InstanceComponents()
+{
+	for (FManagedProjectileSubPool& Pool : SubPools)
+	{
+		if (Pool.InstanceComponent)
+		{
+			Pool.InstanceComponent->DestroyComponent();
+			Pool.InstanceComponent = nullptr;
+		}
+
+		Pool.NumRenderedInstances = 0;
+	}
+}
+
+/*  Creates a  new pool, or adds on to the current one 
+	@param: InClassId: The class id of the pool.
+	@param: DesiredSize: The Desired size the pool should be. 
+	@returns: boolean if the operation is successful.
+*/
+bool AProjectileManagerBase::Create_ProjectilePool(int32 InClassId, int32 DesiredSize)
+{
+	PROJECTILE_SCOPE_STAT(CreatePool);
+
+	if (!IsValidClassId(InClassId) || DesiredSize <= 0 || DesiredSize - GetActorPoolSize(InClassId) <= 0)
+	{
+		UE_LOG(LogClass, Error, TEXT("Projectile Manager Can not allocate a projectile pool at or below the value of 0. Requested Size: %d"), DesiredSize);
+		return false;
+	}
+	else
+	{
+		FManagedProjectileSubPool& Pool = SubPools[InClassId];
+
+		if (!GetWorld()) return false;
+		else if (InitSettings.IsCreationTimeSliced())
+		{
+			// a creation already running keeps its start so the progress stays continuous. 
+			if (!Pool.IsCreating())
+			{
+				Pool.CreationStartSize = Pool.GetActorPoolSize();
+			}
+
+			Pool.PendingCreationTarget = DesiredSize;
+			RefreshManagerTickEnabled();
+			return true;
+		}
+		else
+		{
+			// create the whole pool now. 
+			Spawn_PooledProjectiles(InClassId, DesiredSize - Pool.GetActorPoolSize(), 0.0);
+			OnPoolCreationComplete.Broadcast(InClassId, Pool.GetActorPoolSize());
+
+			// did we complete successfully? 
+			return Pool.GetActorPoolSize() == DesiredSize;
+		}
+	}
+}
+
+/*	Spawns projectiles into a classes pool. Tombstones are refilled first, the rest are appended. 
+	Every projectile goes straight onto the free list, so it can be pulled the moment it exists. 
+	@param: InClassId: The class id of the pool.
+	@param: InAmountToSpawn: The most projectiles to spawn.
+	@param: InBudgetSeconds: The time to stop after, 0 spawns them all. At least one is always spawned.
+	@returns: the number of projectiles added to the pool.
+*/
+int32 AProjectileManagerBase::Spawn_PooledProjectiles(int32 InClassId, int32 InAmountToSpawn, double InBudgetSeconds)
+{
+	PROJECTILE_SCOPE_STAT(Spawn);
+
+	UWorld* const world = GetWorld();
+	if (!world || !IsValidClassId(InClassId) || InAmountToSpawn <= 0) return 0;
+
+	FManagedProjectileSubPool& Pool = SubPools[InClassId];
+
+	// set up spawn params
+	FActorSpawnParameters spawnParams;
+	spawnParams.Owner = this;
+	spawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	spawnParams.Instigator = nullptr;
+
+	const double EndTime = FPlatformTime::Seconds() + InBudgetSeconds;
+	const bool bBudgeted = InBudgetSeconds > 0.0;
+
+	// tombstones are refilled first, walk them with a single cursor. 
+	int32 TombstoneSearchIndex = 0;
+	int32 NumSpawned = 0;
+
+	for (int32 i = 0; i < InAmountToSpawn; i++)
+	{
+		// spawn a projectile 
+		if (AManagedProjectileBase* projectile = world->SpawnActor<AManagedProjectileBase>(Pool.GetProjectileClass(), GetPoolLocation(), FRotator::ZeroRotator, spawnParams))
+		{
+			// set if the projectiles outside collision needs to be on at start or not. 
+			projectile->Request_UpdateFromPool(GetReturnRequestOfClass(InClassId));
+
+			// add this object to the record as needed, save this object as the deleter. 
+			{
+				FRWScopeLock WriteLock(PoolLock, SLT_Write);
+				Pool.AddProjectile(projectile, TombstoneSearchIndex);
+			}
+
+			// hand the tick over to the manager, or set the projectile up to tick async to the game thread. 
+			if (IsTickBatched()) projectile->SetTickedByManager(true);
+			else projectile->Requst_TickMoveToAsync(OptimizeProjectilesMustTickAsync());
+			PROJECTILE_COUNT_STAT(Spawned, 1);
+
+			// new projectiles start in the pool, park them like a return would. 
+			if (ShouldParkUnregistered()) projectile->Request_Park();
+			NumSpawned++;
+		}
+
+		// the clock is only read between spawns, one spawn can run over the budget. 
+		if (bBudgeted && FPlatformTime::Seconds() >= EndTime) break;
+	}
+
+	Report_PoolOccupancy();
+	return NumSpawned;
+}
+
+/* Spawns this frames share of the time sliced pools, the budget is shared by the classes in order. */
+void AProjectileManagerBase::Advance_PoolCreation()
+{
+	const double EndTime = FPlatformTime::Seconds() + InitSettings.GetCreationBudgetSeconds();
+
+	for (int32 ClassId = 0; ClassId < SubPools.Num(); ClassId++)
+	{
+		FManagedProjectileSubPool& Pool = SubPools[ClassId];
+		if (!Pool.IsCreating()) continue;
+
+		// the rest of the classes wait for next frame once the budget is gone. 
+		const double BudgetLeft = EndTime - FPlatformTime::Seconds();
+		if (BudgetLeft <= 0.0) break;
+
+		const int32 NumRemaining = Pool.PendingCreationTarget - Pool.GetActorPoolSize();
+		const int32 NumSpawned = Spawn_PooledProjectiles(ClassId, NumRemaining, BudgetLeft);
+
+		// a class that fails to spawn would never finish, give up on the rest. 
+		if (NumSpawned == 0 && NumRemaining > 0)
+		{
+			UE_LOG(LogClass, Error, TEXT("Projectile Manager failed to spawn any projectiles of class id %d this frame, stopping pool creation at %d of %d"), ClassId, Pool.GetActorPoolSize(), Pool.PendingCreationTarget);
+			Pool.PendingCreationTarget = Pool.GetActorPoolSize();
+		}
+
+		OnPoolCreationProgress.Broadcast(ClassId, Pool.GetActorPoolSize() - Pool.CreationStartSize, Pool.PendingCreationTarget - Pool.CreationStartSize);
+
+		if (Pool.GetActorPoolSize() >= Pool.PendingCreationTarget)
+		{
+			Pool.PendingCreationTarget = 0;
+			OnPoolCreationComplete.Broadcast(ClassId, Pool.GetActorPoolSize());
+		}
+	}
+
+	RefreshManagerTickEnabled();
+}
+
+/*	Follows the demand of each class. The high water mark jumps up with the in use count and 
+	decays back down, a pool grows as soon as the mark plus headroom passes the size it is 
+	building toward, and shrinks to it only after being over sized for the whole cooldown. 
+	The data mode only grows. 
+	@param: DeltaTime: The frame time.
+*/
+void AProjectileManagerBase::Update_Autoscaling(float DeltaTime)
+{
+	const float HighWaterDecay = AutoscaleSettings.GetHighWaterDecay(DeltaTime);
+
+	for (int32 ClassId = 0; ClassId < SubPools.Num(); ClassId++)
+	{
+		FProjectilePoolTelemetry& Telemetry = SubPools[ClassId].Telemetry;
+		Telemetry.SampleInUse(GetInUseCountOf(ClassId), HighWaterDecay);
+
+		const bool bCreating = SubPools[ClassId].IsCreating();
+		const int32 TargetSize = GetAutoscaleTargetSize(ClassId);
+		const int32 CurrentSize = bCreating ? SubPools[ClassId].PendingCreationTarget : GetPoolSizeOf(ClassId);
+
+		if (TargetSize > CurrentSize)
+		{
+			Telemetry.OversizedTime = 0.f;
+
+			int32 NewSize = TargetSize;
+			if (Request_ResizeProjectileSubPool(ClassId, NewSize)) SubPools[ClassId].Telemetry.GrowCount++;
+		}
+		else if (TargetSize < CurrentSize && !IsDataSimulationMode() && !bCreating)
+		{
+			Telemetry.OversizedTime += DeltaTime;
+
+			if (Telemetry.OversizedTime >= AutoscaleSettings.GetShrinkCooldown())
+			{
+				Telemetry.OversizedTime = 0.f;
+
+				int32 NewSize = TargetSize;
+				if (Request_ResizeProjectileSubPool(ClassId, NewSize)) SubPools[ClassId].Telemetry.ShrinkCount++;
+			}
+		}
+		else
+		{
+			Telemetry.OversizedTime = 0.f;
+		}
+	}
+}
+
+/*	Buckets every live projectile by its distance to the closest viewpoint and its time since 
+	fire, every reevaluate interval. A projectile is only touched when its bucket changes, the 
+	step rate then goes to its own tick functions or to the batched tick. 
+	@param: DeltaTime: The frame time, the full step rate the savings are measured against.
+*/
+void AProjectileManagerBase::Update_Significance(float DeltaTime)
+{
+	PROJECTILE_SCOPE_STAT(Significance);
+
+	SignificanceTimer += DeltaTime;
+	if (SignificanceTimer < SignificanceSettings.GetReevaluateInterval()) return;
+	SignificanceTimer = 0.f;
+
+	// with nothing to be near to, everything keeps the rate it has. 
+	Gather_SignificanceViewLocations();
+	if (SignificanceViewLocations.Num() <= 0) return;
+
+	const TArray<FProjectileSignificanceBucket>& Buckets = SignificanceSettings.GetBuckets();
+	const float Now = GetWorld()->GetTimeSeconds();
+	const float FullStepRate = DeltaTime > 0.f ? 1.f / DeltaTime : 0.f;
+
+	FProjectileSignificanceStats Stats;
+	Stats.BatchedStepsSkipped = SignificanceStats.BatchedStepsSkipped;
+
+	for (FManagedProjectileSubPool& Pool : SubPools)
+	{
+		for (int32 i = 0; i < Pool.Entries.Num(); i++)
+		{
+			FManagedProjectileEntry& Entry = Pool.Entries[i];
+			if (!Pool.IsEntryInUse(i) || Entry.IsPendingReturn()) continue;
+
+			AManagedProjectileBase* Projectile = Entry.GetManagedProjectilePtr();
+			if (!Projectile) continue;
+
+			const FVector Location = Projectile->GetActorLocation();
+			float ClosestDistSquared = MAX_flt;
+			for (const FVector& ViewLocation : SignificanceViewLocations)
+			{
+				ClosestDistSquared = FMath::Min(ClosestDistSquared, FVector::DistSquared(Location, ViewLocation));
+			}
+
+			// the last bucket the projectile is past on both counts. 
+			const float TimeSinceFire = Now - Entry.FireTime;
+			int32 Bucket = Buckets.Num() - 1;
+			while (Bucket >= 0 && (ClosestDistSquared < Buckets[Bucket].GetMinDistanceSquared() || TimeSinceFire < Buckets[Bucket].GetMinTimeSinceFire())) Bucket--;
+
+			if (Bucket != Entry.SignificanceBucket)
+			{
+				Entry.SignificanceBucket = Bucket;
+				Projectile->SetSimulationStepInterval(Bucket == INDEX_NONE ? 0.f : Buckets[Bucket].GetStepInterval());
+			}
+
+			if (Bucket == INDEX_NONE)
+			{
+				Stats.NumFullRate++;
+			}
+			else
+			{
+				const float StepInterval = Buckets[Bucket].GetStepInterval();
+				Stats.NumReduced++;
+				Stats.StepsSavedPerSecond += StepInterval > 0.f ? FMath::Max(FullStepRate - 1.f / StepInterval, 0.f) : 0.f;
+			}
+		}
+	}
+
+	SignificanceStats = Stats;
+}
+
+/* Gathers the registered viewpoints, or the player view points when none are registered. */
+void AProjectileManagerBase::Gather_SignificanceViewLocations()
+{
+	SignificanceViewLocations.Reset();
+
+	for (int32 i = SignificanceViewpoints.Num() - 1; i >= 0; i--)
+	{
+		if (AActor* Viewpoint = SignificanceViewpoints[i].Get()) SignificanceViewLocations.Add(Viewpoint->GetActorLocation());
+		else SignificanceViewpoints.RemoveAtSwap(i);
+	}
+
+	if (SignificanceViewLocations.Num() > 0) return;
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			SignificanceViewLocations.Add(ViewLocation);
+		}
+	}
+}
+
+/*	Grows an exhausted pool within the frame so the acquire can still succeed. Enough is spawned 
+	for the request plus the headroom on top of what is in use, the next frames autoscale 
+	pass then takes over. 
+	@param: InClassId: The class id of the exhausted pool.
+	@param: InNumNeeded: The entries the acquire is short by.
+	@returns: the number of entries added.
+*/
+int32 AProjectileManagerBase::Grow_OnExhaustion(int32 InClassId, int32 InNumNeeded)
+{
+	if (!AutoscaleSettings.ShouldGrowOnExhaustion() || !IsValidClassId(InClassId) || InNumNeeded <= 0) return 0;
+
+	const int32 CurrentSize = GetPoolSizeOf(InClassId);
+	const int32 Headroom = FMath::CeilToInt((GetInUseCountOf(InClassId) + InNumNeeded) * AutoscaleSettings.GetGrowHeadroom());
+	const int32 NewSize = int32(FMath::Min<int64>(int64(CurrentSize) + InNumNeeded + Headroom, AutoscaleSettings.GetMaxPoolSize()));
+	if (NewSize <= CurrentSize) return 0;
+
+	SubPools[InClassId].Telemetry.GrowCount++;
+
+	if (IsDataSimulationMode())
+	{
+		SimulationData.Grow(NewSize);
+	}
+	else
+	{
+		// the acquire can't wait for a time slice, spawn the shortfall now. 
+		Spawn_PooledProjectiles(InClassId, NewSize - CurrentSize, 0.0);
+	}
+
+	return GetPoolSizeOf(InClassId) - CurrentSize;
+}
+
+/*	Gets the pool size the demand wants for a class. 
+	@param: InClassId: The class id.
+	@returns: the high water mark plus headroom, within the min and max pool sizes.
+*/
+int32 AProjectileManagerBase::GetAutoscaleTargetSize(int32 InClassId) const
+{
+	const FManagedProjectileSubPool& Pool = SubPools[InClassId];
+	const int32 Wanted = FMath::CeilToInt(Pool.Telemetry.HighWaterMark * (1.f + AutoscaleSettings.GetGrowHeadroom()));
+	return FMath::Clamp(Wanted, AutoscaleSettings.GetMinPoolSize(Pool.StartingPoolSize), AutoscaleSettings.GetMaxPoolSize());
+}
+
+/*	Stops a time sliced creation where it is. 
+	@param: InClassId: The class id of the pool.
+*/
+void AProjectileManagerBase::Cancel_PoolCreation(int32 InClassId)
+{
+	if (!IsValidClassId(InClassId) || !SubPools[InClassId].IsCreating()) return;
+
+	SubPools[InClassId].PendingCreationTarget = 0;
+	RefreshManagerTickEnabled();
+}
+
+/* The actor tick simulates the data, runs the managed collision, builds a time sliced pool and autoscales. */
+void AProjectileManagerBase::RefreshManagerTickEnabled()
+{
+	SetActorTickEnabled(IsDataSimulationMode() || IsCollisionManaged() || IsCreatingPool() || ShouldAutoscale() || ShouldEvaluateSignificance() || ExpiryWheel.Num() > 0 || GlobalSettings.AllowAnyAsyncRequests());
+}
+
+/*	Advances every live actorless projectile through the ballistic kernel. The live range is 
+	split into chunks that are spread across the task graph, then merged on the game thread. 
+	@param: DeltaTime: The frame time to advance by.
+*/
+void AProjectileManagerBase::Simulate_ProjectileData(float DeltaTime)
+{
+	PROJECTILE_SCOPE_STAT(SimulateData);
+
+	UWorld* const world = GetWorld();
+	if (!world || SimulationData.Num() <= 0) return;
+
+	const FProjectileBallisticParams Params(FVector(0.f, 0.f, world->GetGravityZ() * SimulationSettings.GetGravityScale()), SimulationSettings.GetLinearDrag(), SimulationSettings.GetMaxSpeed());
+
+	// projectiles that fall out of the world expire like they would as actors. 
+	AWorldSettings* const worldSettings = world->GetWorldSettings();
+	const float KillZ = worldSettings && worldSettings->bEnableWorldBoundsChecks ? worldSettings->KillZ : -BIG_NUMBER;
+
+	// split the live range into chunks, each gets its own result buffer. 
+	const int32 ChunkSize = SimulationSettings.GetParallelChunkSize();
+	const int32 NumChunks = FMath::DivideAndRoundUp(SimulationData.Num(), ChunkSize);
+	SimulationChunkResults.SetNum(NumChunks, false);
+
+	// group the chunks into one task per worker, strided so the tasks stay even. 
+	const bool bParallel = SimulationSettings.GetSimulateInParallel() && NumChunks > 1 && FApp::ShouldUseThreadingForPerformance();
+	const int32 MaxWorkers = SimulationSettings.GetMaxParallelWorkers() > 0 ? SimulationSettings.GetMaxParallelWorkers() : FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	const int32 NumTasks = bParallel ? FMath::Clamp(MaxWorkers, 1, NumChunks) : 1;
+
+	ParallelFor(NumTasks, [this, NumTasks, NumChunks, ChunkSize, DeltaTime, &Params, KillZ](int32 TaskIndex)
+	{
+		for (int32 ChunkIndex = TaskIndex; ChunkIndex < NumChunks; ChunkIndex += NumTasks)
+		{
+			Simulate_ProjectileChunk(ChunkIndex, ChunkSize, DeltaTime, Params, KillZ);
+		}
+	}, !bParallel);
+
+	Resolve_ProjectileChunkResults();
+}
+
+/*	Advances one chunk and records the projectiles that expired in the chunks own result. 
+	Only touches the chunks own range of the data, so chunks can run on any worker at once. 
+	@param: InChunkIndex: The chunk to simulate.
+	@param: InChunkSize: The number of projectiles per chunk.
+	@param: DeltaTime: The frame time to advance by.
+	@param: Params: The gravity, drag and max speed.
+	@param: KillZ: The height below which projectiles expire. Lifetimes are left to the expiry wheel.
+*/
+void AProjectileManagerBase::Simulate_ProjectileChunk(int32 InChunkIndex, int32 InChunkSize, float DeltaTime, const FProjectileBallisticParams& Params, float KillZ)
+{
+	const int32 StartIndex = InChunkIndex * InChunkSize;
+	const int32 Count = FMath::Min(InChunkSize, SimulationData.Num() - StartIndex);
+
+	if (SimulationSettings.GetUseVectorizedKernel())
+	{
+		FProjectileBallisticKernel::Integrate_Vectorized(SimulationData, StartIndex, Count, DeltaTime, Params);
+		if (SimulationSettings.GetRotationFollowsVelocity()) FProjectileBallisticKernel::ComputeOrientations_Vectorized(SimulationData, StartIndex, Count);
+	}
+	else
+	{
+		FProjectileBallisticKernel::Integrate_Scalar(SimulationData, StartIndex, Count, DeltaTime, Params);
+		if (SimulationSettings.GetRotationFollowsVelocity()) FProjectileBallisticKernel::ComputeOrientations_Scalar(SimulationData, StartIndex, Count);
+	}
+
+	// record the expirations, the removes happen on the game thread once every chunk is done. 
+	FProjectileSimulationChunkResult& Result = SimulationChunkResults[InChunkIndex];
+	Result.Reset();
+
+	const float* RESTRICT PositionsZ = SimulationData.PositionsZ.GetData();
+
+	for (int32 i = StartIndex, End = StartIndex + Count; i < End; i++)
+	{
+		if (PositionsZ[i] < KillZ)
+		{
+			Result.Expired.Add(i);
+		}
+	}
+}
+
+/*	Merges every chunks result. Expirations are removed from the highest dense index down so 
+	the swap removes never move one that is still pending, the events go out once the data is 
+	settled so listeners are free to fire or return projectiles. 
+*/
+void AProjectileManagerBase::Resolve_ProjectileChunkResults()
+{
+	TArray<TPair<FProjectileHandle, FVector>, TInlineAllocator<64>> ExpiredThisStep;
+
+	for (int32 ChunkIndex = SimulationChunkResults.Num() - 1; ChunkIndex >= 0; ChunkIndex--)
+	{
+		const TArray<int32>& Expired = SimulationChunkResults[ChunkIndex].Expired;
+
+		for (int32 i = Expired.Num() - 1; i >= 0; i--)
+		{
+			const int32 DenseIndex = Expired[i];
+			ExpiredThisStep.Emplace(SimulationData.GetHandle(DenseIndex), SimulationData.GetPosition(DenseIndex));
+			SimulationData.RemoveAtDense(DenseIndex);
+		}
+	}
+
+	// counted and reported once for the whole step. 
+	if (ExpiredThisStep.Num() > 0)
+	{
+		PROJECTILE_COUNT_STAT(Returns, ExpiredThisStep.Num());
+		Report_PoolOccupancy();
+	}
+
+	for (const TPair<FProjectileHandle, FVector>& Expired : ExpiredThisStep)
+	{
+		Broadcast_ProjectileExpired(Expired.Key, Expired.Value);
+	}
+}
+
+/*	Issues one async sweep per live projectile that asked for collision. The results are read 
+	next frame, so the physics scene does the work alongside the rest of the frame. 
+	@param: DeltaTime: The frame time the data projectiles were just advanced by.
+*/
+void AProjectileManagerBase::Issue_AsyncSweeps(float DeltaTime)
+{
+	PROJECTILE_SCOPE_STAT(IssueSweeps);
+
+	UWorld* const world = GetWorld();
+	if (!world) return;
+
+	const ECollisionChannel Channel = CollisionSettings.GetSweepChannel();
+	const bool bIgnoreOwners = CollisionSettings.GetIgnoreOwningActor();
+
+	FCollisionQueryParams BaseParams(SCENE_QUERY_STAT(ProjectileManagerSweep), CollisionSettings.GetTraceComplex(), this);
+
+	if (IsDataSimulationMode())
+	{
+		for (int32 i = 0, Num = SimulationData.Num(); i < Num; i++)
+		{
+			if (!SimulationData.HasFlag(i, EProjectileSimulationFlags::CollisionEnabled)) continue;
+
+			// the step just taken was the current velocity over the frame, so that is the swept segment. 
+			const FVector End = SimulationData.GetPosition(i);
+			const FVector Start = End - SimulationData.GetVelocity(i) * DeltaTime;
+			if (Start.Equals(End)) continue;
+
+			FCollisionQueryParams Params = BaseParams;
+			if (bIgnoreOwners && SimulationData.Owners[i].IsValid()) Params.AddIgnoredActor(SimulationData.Owners[i].Get());
+
+			const FTraceHandle Trace = world->AsyncSweepByChannel(EAsyncTraceType::Single, Start, End, FQuat::Identity, Channel, FCollisionShape::MakeSphere(SimulationData.CollisionRadii[i]), Params);
+			PendingAsyncSweeps.Emplace(Trace, SimulationData.GetHandle(i));
+		}
+	}
+	else
+	{
+		for (int32 ClassId = 0; ClassId < SubPools.Num(); ClassId++)
+		{
+			FManagedProjectileSubPool& Pool = SubPools[ClassId];
+			TArray<FManagedProjectileEntry>& Entries = Pool.Entries;
+
+			for (int32 i = 0, Num = Entries.Num(); i < Num; i++)
+			{
+				FManagedProjectileEntry& Entry = Entries[i];
+				AManagedProjectileBase* Projectile = Entry.GetManagedProjectilePtr();
+				if (!Projectile || !Pool.IsEntryInUse(i) || !Entry.ShouldSweepForHits()) continue;
+
+				// sweep from where the last sweep ended to where the actor is now. 
+				const FVector Start = Entry.LastSweptLocation;
+				const FVector End = Projectile->GetActorLocation();
+				Entry.LastSweptLocation = End;
+				if (Start.Equals(End)) continue;
+
+				FCollisionQueryParams Params = BaseParams;
+				Params.AddIgnoredActor(Projectile);
+				if (bIgnoreOwners && Entry.SweepOwningActor.IsValid()) Params.AddIgnoredActor(Entry.SweepOwningActor.Get());
+
+				const float Radius = Projectile->SphereCollision ? Projectile->SphereCollision->GetScaledSphereRadius() : 0.f;
+				const FTraceHandle Trace = world->AsyncSweepByChannel(EAsyncTraceType::Single, Start, End, FQuat::Identity, Channel, FCollisionShape::MakeSphere(Radius), Params);
+				PendingAsyncSweeps.Emplace(Trace, FProjectileHandle(i, Pool.GetEntryGeneration(i), ClassId));
+			}
+		}
+	}
+}
+
+/*	Reads the results of last frames sweeps. A hit raises the hit event, then returns the 
+	projectile if the settings ask for it. Handles are resolved again after the event, as a 
+	listener may have returned the projectile already. 
+*/
+void AProjectileManagerBase::Consume_AsyncSweeps()
+{
+	PROJECTILE_SCOPE_STAT(ConsumeSweeps);
+
+	UWorld* const world = GetWorld();
+	if (!world) return;
+
+	// take the list, the events can fire more projectiles. 
+	TArray<TPair<FTraceHandle, FProjectileHandle>> SweepsToConsume = MoveTemp(PendingAsyncSweeps);
+	PendingAsyncSweeps.Reset();
+
+	FTraceDatum SweepResult;
+	for (const TPair<FTraceHandle, FProjectileHandle>& Sweep : SweepsToConsume)
+	{
+		if (!world->QueryTraceData(Sweep.Key, SweepResult)) continue;
+
+		const FHitResult* Hit = SweepResult.OutHits.FindByPredicate([](const FHitResult& Result) { return Result.bBlockingHit; });
+		if (!Hit) continue;
+
+		// only report projectiles that are still on the use the sweep was issued for, and not already returned. 
+		if (!IsProjectileInFlight(Sweep.Value)) continue;
+
+		OnManagedProjectileHit.Broadcast(Sweep.Value, *Hit);
+		Return_HitProjectile(Sweep.Value);
+	}
+}
+
+/*	Tests every live projectile that wants collision against the registered targets. The 
+	touches are all found first, then the callbacks run, so a callback that fires or returns 
+	projectiles can't disturb the pass. A projectile touching two targets in one frame only 
+	reports both if it is not returned on hit. A target a callback removes keeps its id 
+	until the next rebuild, so its remaining touches can't reach a target added after it. 
+*/
+void AProjectileManagerBase::Test_RegisteredTargets()
+{
+	if (TargetHash.Num() == 0) return;
+
+	TargetHash.Rebuild(CollisionSettings.GetTargetCellSize());
+	TargetTouches.Reset();
+
+	if (IsDataSimulationMode())
+	{
+		for (int32 i = 0, Num = SimulationData.Num(); i < Num; i++)
+		{
+			if (!SimulationData.HasFlag(i, EProjectileSimulationFlags::CollisionEnabled)) continue;
+
+			const FVector Location = SimulationData.GetPosition(i);
+			TouchedTargetIds.Reset();
+			TargetHash.QueryTouchingTargets(Location, SimulationData.CollisionRadii[i], TouchedTargetIds);
+
+			for (int32 TargetId : TouchedTargetIds)
+			{
+				TargetTouches.Emplace(SimulationData.GetHandle(i), TargetId, Location);
+			}
+		}
+	}
+	else
+	{
+		for (int32 ClassId = 0; ClassId < SubPools.Num(); ClassId++)
+		{
+			const FManagedProjectileSubPool& Pool = SubPools[ClassId];
+			const TArray<FManagedProjectileEntry>& Entries = Pool.Entries;
+
+			for (int32 i = 0, Num = Entries.Num(); i < Num; i++)
+			{
+				const FManagedProjectileEntry& Entry = Entries[i];
+				const AManagedProjectileBase* Projectile = Entry.GetManagedProjectilePtr();
+				if (!Projectile || !Pool.IsEntryInUse(i) || !Entry.ShouldSweepForHits() || Entry.IsPendingReturn()) continue;
+
+				const FVector Location = Projectile->GetActorLocation();
+				const float Radius = Projectile->SphereCollision ? Projectile->SphereCollision->GetScaledSphereRadius() : 0.f;
+				TouchedTargetIds.Reset();
+				TargetHash.QueryTouchingTargets(Location, Radius, TouchedTargetIds);
+
+				for (int32 TargetId : TouchedTargetIds)
+				{
+					TargetTouches.Emplace(FProjectileHandle(i, Pool.GetEntryGeneration(i), ClassId), TargetId, Location);
+				}
+			}
+		}
+	}
+
+	for (const FProjectileTargetTouch& Touch : TargetTouches)
+	{
+		// skip projectiles a previous touch or gameplay returned, and targets a previous callback removed. 
+		if (!IsProjectileInFlight(Touch.ProjectileHandle) || !TargetHash.IsTargetRegistered(Touch.TargetId)) continue;
+
+		if (const FOnProjectileTargetTouched* Callback = TargetHash.GetTargetCallback(Touch.TargetId))
+		{
+			Callback->ExecuteIfBound(Touch.ProjectileHandle, Touch.TargetId, Touch.ProjectileLocation);
+		}
+
+		OnProjectileTargetHit.Broadcast(Touch.ProjectileHandle, Touch.TargetId, TargetHash.GetTargetActor(Touch.TargetId));
+		Return_HitProjectile(Touch.ProjectileHandle);
+	}
+}
+
+/*	Returns a projectile after a hit when the settings ask for it. The handle is resolved again, 
+	a hit listener may already have returned it. 
+	@param: InHandle: The handle of the projectile that hit something.
+*/
+void AProjectileManagerBase::Return_HitProjectile(const FProjectileHandle& InHandle)
+{
+	if (CollisionSettings.GetReturnOnHit())
+	{
+		Return_ProjectileByHandle(InHandle);
+	}
+}
+
+/*	Returns a live projectile of either mode by its handle, stale handles are ignored. 
+	@param: InHandle: The handle of the projectile to return.
+*/
+void AProjectileManagerBase::Return_ProjectileByHandle(const FProjectileHandle& InHandle)
+{
+	if (IsDataSimulationMode())
+	{
+		const int32 DenseIndex = SimulationData.ResolveHandle(InHandle);
+		if (DenseIndex >= 0) Return_SimulatedProjectileAt(DenseIndex);
+	}
+	else
+	{
+		const int32 ClassId = InHandle.GetPoolIndex();
+		const int32 EntryIndex = ResolveHandle(InHandle);
+		if (EntryIndex >= 0 && !SubPools[ClassId].Entries[EntryIndex].IsPendingReturn())
+		{
+			ShouldDeferReturns() ? QueueEntryForReturn(ClassId, EntryIndex) : ReturnEntryToPool(ClassId, EntryIndex);
+		}
+	}
+}
+
+/*	Removes a live actorless projectile and counts it as a return, like an actor return would be. 
+	@param: DenseIndex: The dense index of the projectile to remove.
+*/
+void AProjectileManagerBase::Return_SimulatedProjectileAt(int32 DenseIndex)
+{
+	SimulationData.RemoveAtDense(DenseIndex);
+	PROJECTILE_COUNT_STAT(Returns, 1);
+	Report_PoolOccupancy();
+}
+
+/*	Schedules the lifetime and travel limit of a projectile use on the expiry wheel. The travel 
+	limit is first checked when the projectile would reach it at its fire speed. 
+	@param: InHandle: The handle issued for the use.
+	@param: InRequest: The pull or fire settings holding the limits.
+	@param: InLifetimeCap: A manager wide lifetime, the shorter of it and the requests is used. 0 for none.
+*/
+void AProjectileManagerBase::Schedule_Expiry(const FProjectileHandle& InHandle, const FProjectilePoolRequest& InRequest, float InLifetimeCap)
+{
+	float Lifetime = InRequest.GetMaxLifetime();
+	if (InLifetimeCap > 0.f) Lifetime = Lifetime > 0.f ? FMath::Min(Lifetime, InLifetimeCap) : InLifetimeCap;
+
+	if (Lifetime <= 0.f && InRequest.GetMaxTravelDistance() <= 0.f) return;
+
+	FProjectileExpiry Expiry;
+	Expiry.ProjectileHandle = InHandle;
+	Expiry.Origin = InRequest.GetStartLocation();
+	Expiry.MaxTravelDistance = InRequest.GetMaxTravelDistance();
+	Expiry.LifetimeTick = Lifetime > 0.f ? ExpiryWheel.GetTickAfter(Lifetime) : MAX_int64;
+
+	float Delay = Lifetime > 0.f ? Lifetime : MAX_flt;
+	if (Expiry.HasTravelLimit())
+	{
+		Delay = FMath::Min(Delay, InRequest.GetProjectileSpeed() > 0.f ? Expiry.MaxTravelDistance / InRequest.GetProjectileSpeed() : MaxTravelRecheckSeconds);
+	}
+
+	ExpiryWheel.Schedule(Expiry, Delay);
+
+	// the tick drives the wheel. 
+	if (!IsActorTickEnabled()) RefreshManagerTickEnabled();
+}
+
+/*	Returns every projectile whose lifetime ran out or that travelled past its limit. A travel 
+	limit that comes due short of the distance is scheduled again for when the rest of it would be 
+	covered at the current speed. Returns run after the whole batch is gathered. 
+	@param: DeltaTime: The frame time.
+*/
+void AProjectileManagerBase::Update_Expiry(float DeltaTime)
+{
+	PROJECTILE_SCOPE_STAT(Expiry);
+
+	DueExpiries.Reset();
+	ExpiryWheel.Advance(DeltaTime, DueExpiries);
+
+	for (const FProjectileExpiry& Expiry : DueExpiries)
+	{
+		// the projectile may have been returned since, its handle no longer resolves. 
+		FVector Location, Velocity;
+		if (!GetLiveProjectileState(Expiry.ProjectileHandle, Location, Velocity)) continue;
+
+		if (Expiry.HasTravelLimit() && !Expiry.IsLifetimeOver(ExpiryWheel.GetCurrentTick()))
+		{
+			const float DistanceLeft = Expiry.MaxTravelDistance - FVector::Dist(Expiry.Origin, Location);
+			if (DistanceLeft > 0.f)
+			{
+				const float Speed = Velocity.Size();
+				ExpiryWheel.Schedule(Expiry, Speed > KINDA_SMALL_NUMBER ? FMath::Min(DistanceLeft / Speed, MaxTravelRecheckSeconds) : MaxTravelRecheckSeconds);
+				continue;
+			}
+		}
+
+		Broadcast_ProjectileExpired(Expiry.ProjectileHandle, Location);
+		Return_ProjectileByHandle(Expiry.ProjectileHandle);
+	}
+
+	if (ExpiryWheel.Num() <= 0) RefreshManagerTickEnabled();
+}
+
+/*	Raises the expiry events for a projectile of either mode. Every expiry raises 
+	OnManagedProjectileExpired, data mode expiries raise OnSimulatedProjectileExpired as well so 
+	listeners bound to either see the same set whatever ended the projectile. 
+	@param: InHandle: The handle of the expired projectile.
+	@param: InLocation: Where the projectile was when it expired.
+*/
+void AProjectileManagerBase::Broadcast_ProjectileExpired(const FProjectileHandle& InHandle, const FVector& InLocation)
+{
+	OnManagedProjectileExpired.Broadcast(InHandle, InLocation);
+	if (IsDataSimulationMode()) OnSimulatedProjectileExpired.Broadcast(InHandle, InLocation);
+}
+
+/*	Gets where a live projectile of either mode is and how fast it is going. 
+	@param: InHandle: The handle of the projectile.
+	@param: OutLocation: The location of the projectile.
+	@param: OutVelocity: The velocity of the projectile.
+	@returns: if the handle is still live and not waiting on a return.
+*/
+bool AProjectileManagerBase::GetLiveProjectileState(const FProjectileHandle& InHandle, FVector& OutLocation, FVector& OutVelocity) const
+{
+	if (IsDataSimulationMode()) return GetSimulatedProjectileState(InHandle, OutLocation, OutVelocity);
+
+	if (!IsProjectileInFlight(InHandle)) return false;
+
+	const AManagedProjectileBase* Projectile = SubPools[InHandle.GetPoolIndex()].Entries[InHandle.GetSlotIndex()].GetManagedProjectilePtr();
+	if (!Projectile) return false;
+
+	OutLocation = Projectile->GetActorLocation();
+	OutVelocity = Projectile->ProjectileMovement ? Projectile->ProjectileMovement->Velocity : FVector::ZeroVector;
+	return true;
+}
+
+/* Resizes a classes pool to a desired size if possible. 
+	@param: InClassId: The class id of the pool, the data simulation mode only has class id 0. 
+	@param: InNewProjectilePoolSize: the requested size of the pool. 
+	@return: if the pool was resized. 
+*/
+bool AProjectileManagerBase::Resize_ProjectilePool(int32 InClassId, int32& InNewProjectilePoolSize)
+{
+	PROJECTILE_SCOPE_STAT(ResizePool);
+
+	if (InNewProjectilePoolSize <= 0)
+	{
+		UE_LOG(LogClass, Error, TEXT("Can not resize projectile manager pool to any value less than 1, you requested a value of %d for the new pool size"), InNewProjectilePoolSize);
+		return false;
+	}
+	else if (IsDataSimulationMode())
+	{
+		// the data only grows, live projectiles are packed anywhere in the slots. 
+		if (!SimulationData.Grow(InNewProjectilePoolSize))
+		{
+			UE_LOG(LogClass, Error, TEXT("The data simulation pool can only grow, requested %d with a capacity of %d"), InNewProjectilePoolSize, SimulationData.GetCapacity());
+			return false;
+		}
+
+		return true;
+	}
+	else if (!IsValidClassId(InClassId))
+	{
+		UE_LOG(LogClass, Error, TEXT("Can not resize the pool of class id %d, the manager has %d projectile classes"), InClassId, SubPools.Num());
+		return false;
+	}
+
+	FManagedProjectileSubPool& Pool = SubPools[InClassId];
+
+	if (InNewProjectilePoolSize == Pool.GetActorPoolSize() && !Pool.IsCreating())
+	{
+		UE_LOG(LogClass, Error, TEXT("No Need to resize the managed pool as the requested size is the current pool size."));
+		return false;
+	}
+	else
+	{
+		// any earlier shrink that is still draining is replaced by this request. 
+		Pool.PendingRemovalCount = 0;
+
+		// a creation still running is retargeted by a grow, and stopped by anything else. 
+		if (InNewProjectilePoolSize <= Pool.GetActorPoolSize())
+		{
+			Cancel_PoolCreation(InClassId);
+			if (InNewProjectilePoolSize == Pool.GetActorPoolSize()) return true;
+		}
+
+		// if we need to allocate more. 
+		if (InNewProjectilePoolSize > Pool.GetActorPoolSize())
+		{
+			// update the pool with the new target amount
+			return Create_ProjectilePool(InClassId, InNewProjectilePoolSize);
+		}
+		else // else if we need to remove some from the pool. 
+		{
+			int32 NumToRemove = Pool.GetActorPoolSize() - InNewProjectilePoolSize;
+
+			// empty the free slots first so no other thread can reserve what is being removed. 
+			{
+				FRWScopeLock WriteLock(PoolLock, SLT_Write);
+				Pool.ClearFreeList();
+			}
+
+			// tombstone what we can in one pass, then compact and relink what is left. 
+			NumToRemove -= Pool.TombstoneFreeEntries(NumToRemove);
+			{
+				FRWScopeLock WriteLock(PoolLock, SLT_Write);
+				Pool.TrimTrailingTombstones();
+				Pool.RebuildFreeList();
+			}
+
+			// if we didnt find enough to remove, the rest are removed as they are returned. 
+			// the timing of the return is up to the application. 
+			Pool.PendingRemovalCount = NumToRemove;
+			return true;
+		}
+	}
+}
+
+/* Deallocated the whole pool, every class. */
+bool AProjectileManagerBase::CleanUp_ProjectilePool()
+{
+	if (SubPools.Num() <= 0) return false;
+	else
+	{
+		// stop other threads reserving, nothing can be popped once the free slots are empty. 
+		{
+			FRWScopeLock WriteLock(PoolLock, SLT_Write);
+			for (FManagedProjectileSubPool& Pool : SubPools)
+			{
+				Pool.ClearFreeList();
+			}
+		}
+
+		// clean up the allocated objects
+		for (FManagedProjectileSubPool& Pool : SubPools)
+		{
+			Pool.CleanUp();
+		}
+
+		// remove all records. 
+		{
+			FRWScopeLock WriteLock(PoolLock, SLT_Write);
+			SubPools.Empty();
+		}
+		ClassIdsByClass.Empty();
+		PendingReturnHandles.Empty();
+		AsyncCommands.Empty();
+
+		// return true;
+		return true;
+	}	
+}
+
+/*	Marks a popped entry in use with the generation its pop issued. 
+	@param: InClassId: The class id of the entries pool.
+	@param: InEntryIndex: The popped entry.
+	@param: OutHandle: The handle issued for this use.
+	@return: the projectile in the entry.
+*/
+AManagedProjectileBase* AProjectileManagerBase::AcquireEntry(int32 InClassId, int32 InEntryIndex, FProjectileHandle& OutHandle)
+{
+	OutHandle = FProjectileHandle(InEntryIndex, SubPools[InClassId].CommitEntry(InEntryIndex), InClassId);
+
+	AManagedProjectileBase* Projectile = SubPools[InClassId].Entries[InEntryIndex].MarkEntryInUse(OutHandle);
+	PROJECTILE_COUNT_STAT(Acquires, 1);
+	Report_PoolOccupancy();
+
+	return Projectile;
+}
+
+/*	Applies the pull settings to an entry that was just acquired. When the manager does the 
+	collision the projectile itself keeps none, the entry remembers if it wanted any. An 
+	instanced class keeps its actor hidden, the instanced mesh draws it. 
+	@param: InClassId: The class id of the entries pool.
+	@param: InEntryIndex: The acquired entry.
+	@param: InRequest: The pull settings.
+	@return: if the projectile handled the update.
+*/
+bool AProjectileManagerBase::ApplyPullRequest(int32 InClassId, int32 InEntryIndex, const FProjectilePoolRequest& InRequest)
+{
+	FManagedProjectileEntry& Entry = SubPools[InClassId].Entries[InEntryIndex];
+	Entry.SetSweepState(InRequest.GetCollisionEnabledSettings() != ECollisionEnabled::NoCollision, InRequest.GetStartLocation(), InRequest.GetOwningActor());
+	Schedule_Expiry(FProjectileHandle(InEntryIndex, SubPools[InClassId].GetEntryGeneration(InEntryIndex), InClassId), InRequest);
+
+	// the manager sweeps for managed collision, and draws instanced classes, the actor does neither. 
+	bool bApplied = false;
+	if (IsCollisionManaged() || SubPools[InClassId].IsRenderInstanced())
+	{
+		FProjectilePoolRequest ManagedRequest = InRequest;
+		if (IsCollisionManaged()) ManagedRequest.CollisionSettings = ECollisionEnabled::NoCollision;
+		if (SubPools[InClassId].IsRenderInstanced()) ManagedRequest.bHideAfterPoolRequest = true;
+		bApplied = ApplyPoolRequestDeferred(Entry.GetManagedProjectilePtr(), ManagedRequest);
+	}
+	else
+	{
+		bApplied = ApplyPoolRequestDeferred(Entry.GetManagedProjectilePtr(), InRequest);
+	}
+
+	// a parked projectile is moved and set while unregistered, then registers once where it was fired. 
+	AManagedProjectileBase* Projectile = Entry.GetManagedProjectilePtr();
+	if (Projectile && Projectile->IsParked()) Projectile->Request_Unpark();
+
+	// a new shot starts at full rate, the significance pass buckets it again once it has flown. 
+	Entry.FireTime = GetWorld()->GetTimeSeconds();
+	if (Entry.SignificanceBucket != INDEX_NONE)
+	{
+		Entry.SignificanceBucket = INDEX_NONE;
+		if (Projectile) Projectile->SetSimulationStepInterval(0.f);
+	}
+
+	return bApplied;
+}
+
+/*	Applies a pool request to a projectile. The move, the collision change and the visibility 
+	change are all made inside one deferred movement scope, so the component transform and 
+	overlaps are only updated once when the scope closes. 
+	@param: InProjectile: The projectile to update.
+	@param: InRequest: The pull or return settings.
+	@return: if the projectile handled the update.
+*/
+bool AProjectileManagerBase::ApplyPoolRequestDeferred(AManagedProjectileBase* InProjectile, const FProjectilePoolRequest& InRequest)
+{
+	if (!InProjectile) return false;
+	else
+	{
+		FScopedMovementUpdate DeferredMovement(InProjectile->GetRootComponent(), EScopedUpdate::DeferredUpdates);
+		return InProjectile->Request_UpdateFromPool(InRequest);
+	}
+}
+
+/*	Reports the in use count and the pool size to the stats group and the CSV category. With 
+	several managers in the world the stats show the one that changed last. 
+*/
+void AProjectileManagerBase::Report_PoolOccupancy() const
+{
+	PROJECTILE_SET_STAT(InUse, GetInUseCount());
+	PROJECTILE_SET_STAT(PoolSize, GetCurrentPoolSize());
+}
+
+/*	Resolves a handle to the entry it was issued for, in the pool of the handles class. 
+	@param: InHandle: The handle to resolve. 
+	@return: the index of the entry, -1 if the handle is stale, returned already, or out of range.
+*/
+int32 AProjectileManagerBase::ResolveHandle(const FProjectileHandle& InHandle) const
+{
+	return IsValidClassId(InHandle.GetPoolIndex()) ? SubPools[InHandle.GetPoolIndex()].ResolveHandle(InHandle) : INDEX_NONE;
+}
+
+/*	Checks a handle is still in flight, a projectile returned at the end of the frame still 
+	resolves until the return pass runs but its shot is already over. 
+	@param: InHandle: The handle to check. 
+	@return: if the handle is the current use and not queued for return.
+*/
+bool AProjectileManagerBase::IsProjectileInFlight(const FProjectileHandle& InHandle) const
+{
+	if (IsDataSimulationMode()) return SimulationData.ResolveHandle(InHandle) >= 0;
+
+	const int32 EntryIndex = ResolveHandle(InHandle);
+	return EntryIndex >= 0 && !SubPools[InHandle.GetPoolIndex()].Entries[EntryIndex].IsPendingReturn();
+}
+
+/*	Returns a resolved entry to the pool, or removes it if the pool is waiting to shrink. 
+	@param: InClassId: The class id of the entries pool.
+	@param: InEntryIndex: The index of the in use entry to return. 
+	@return: if the entry was returned. 
+*/
+bool AProjectileManagerBase::ReturnEntryToPool(int32 InClassId, int32 InEntryIndex)
+{
+	FManagedProjectileSubPool& Pool = SubPools[InClassId];
+	PROJECTILE_COUNT_STAT(Returns, 1);
+
+	// if we need to remove on return, drain one from the pending count. 
+	if (Pool.PendingRemovalCount > 0)
+	{
+		Pool.TombstoneEntry(InEntryIndex);
+		Pool.PendingRemovalCount--;
+
+		{
+			FRWScopeLock WriteLock(PoolLock, SLT_Write);
+			Pool.TrimTrailingTombstones();
+		}
+
+		Report_PoolOccupancy();
+		return true;
+	}
+	else
+	{
+		// mark as it nots in use. 
+		Pool.Entries[InEntryIndex].UnMarkEntryInUse();
+
+		// park before the return settings, so the collision and visibility changes dont touch the scenes. 
+		AManagedProjectileBase* Projectile = Pool.Entries[InEntryIndex].GetManagedProjectilePtr();
+		if (Projectile && ShouldParkUnregistered()) Projectile->Request_Park();
+
+		// apply the return settings.
+		const bool bApplied = ApplyPoolRequestDeferred(Projectile, GetReturnRequestOfClass(InClassId));
+
+		// only now put it back on the free list, an async pull can pop it the moment it is pushed 
+		// and must not find it half way through being returned. 
+		Pool.PushFreeEntry(InEntryIndex);
+
+		Report_PoolOccupancy();
+		return bApplied;
+	}
+}
+
+/*	Queues a resolved entry for the end of frame return pass. The entry stays in use until 
+	the pass runs, so it cant be handed out again while it is still where it was returned. 
+	@param: InClassId: The class id of the entries pool.
+	@param: InEntryIndex: The index of the in use entry to return. 
+	@return: if the entry is queued, true if it was already queued this frame. 
+*/
+bool AProjectileManagerBase::QueueEntryForReturn(int32 InClassId, int32 InEntryIndex)
+{
+	FManagedProjectileEntry& Entry = SubPools[InClassId].Entries[InEntryIndex];
+
+	// a second return of the same projectile in one frame is dropped. 
+	if (Entry.IsPendingReturn()) return true;
+	else
+	{
+		Entry.MarkPendingReturn(true);
+		PendingReturnHandles.Add(FProjectileHandle(InEntryIndex, SubPools[InClassId].GetEntryGeneration(InEntryIndex), InClassId));
+
+		// make sure the return pass runs. 
+		ReturnTickFunction.SetTickFunctionEnable(true);
+		return true;
+	}
+}
+
+//-----------------------------------------------------------------------------------
+// Managed Projectile Sub Pool Methods												-
+//-----------------------------------------------------------------------------------
+/*	Adds a freshly spawned projectile to the pool and the free list. 
+	@param: InProjectile: The spawned projectile.
+	@param: InOutTombstoneCursor: Where the search for the next tombstone starts, kept across a batch of adds.
+*/
+void FManagedProjectileSubPool::AddProjectile(AManagedProjectileBase* InProjectile, int32& InOutTombstoneCursor)
+{
+	// the entry is filled before the slot is freed, so a pop never finds an empty entry. 
+	if (Slots.GetNumEmpty() > 0)
+	{
+		while (!IsEntryTombstone(InOutTombstoneCursor)) InOutTombstoneCursor++;
+
+		Entries[InOutTombstoneCursor] = FManagedProjectileEntry(InProjectile);
+		Slots.FillEmptySlot(InOutTombstoneCursor);
+	}
+	else
+	{
+		Entries.Add(FManagedProjectileEntry(InProjectile));
+		Slots.AddFreeSlot();
+	}
+}
+
+/*	Pops the head of the free list, the slot is reserved under a fresh generation. 
+	@return: the index of the free entry, -1 if the pool is exhausted.
+*/
+int32 FManagedProjectileSubPool::PopFreeEntry()
+{
+	return Slots.ReserveSlot().Index;
+}
+
+/*	Pops entries off the free list until we have enough or the pool is exhausted. 
+	@param: InNumWanted: The number of entries wanted.
+	@param: OutEntryIndexs: The popped entries, appended to.
+	@return: the number of entries popped.
+*/
+int32 FManagedProjectileSubPool::PopFreeEntries(int32 InNumWanted, TArray<int32>& OutEntryIndexs)
+{
+	OutEntryIndexs.Reserve(OutEntryIndexs.Num() + FMath::Min(InNumWanted, Slots.NumFree()));
+
+	// other threads can pop at the same time, so pop until empty rather than trusting the count. 
+	int32 NumPopped = 0;
+	for (; NumPopped < InNumWanted; NumPopped++)
+	{
+		const int32 PoppedEntry = PopFreeEntry();
+		if (PoppedEntry == INDEX_NONE) break;
+
+		OutEntryIndexs.Add(PoppedEntry);
+	}
+
+	return NumPopped;
+}
+
+/*	Hands out an entry popped on the game thread. 
+	@param: InEntryIndex: The reserved entry.
+	@return: the generation of the use.
+*/
+int32 FManagedProjectileSubPool::CommitEntry(int32 InEntryIndex)
+{
+	return Slots.CommitSlot(InEntryIndex).Generation;
+}
+
+/*	Hands out an entry reserved off the game thread. 
+	@param: InHandle: The handle issued with the reservation.
+	@return: if the reservation still held, a clean up or a resize since drops it.
+*/
+bool FManagedProjectileSubPool::CommitReservedEntry(const FProjectileHandle& InHandle)
+{
+	return Slots.CommitReservation(FManagedProjectileSlotPool::FHandle(InHandle.GetSlotIndex(), InHandle.GetGeneration()));
+}
+
+/*	Frees an in use entry and pushes it onto the head of the free list, the most recently returned is handed out first. 
+	@param: InEntryIndex: The index of the entry that is now free.
+*/
+void FManagedProjectileSubPool::PushFreeEntry(int32 InEntryIndex)
+{
+	Slots.ReleaseAt(InEntryIndex);
+}
+
+/* Takes every entry off the free list, the entries stay free for the rebuild after. */
+void FManagedProjectileSubPool::ClearFreeList()
+{
+	Slots.ClearFreeSlots();
+}
+
+/* Rebuilds the free list by walking the whole pool, only used after a bulk shrink. */
+void FManagedProjectileSubPool::RebuildFreeList()
+{
+	// the front of the pool ends up on top, tombstones and reserved entries are never pushed. 
+	Slots.RebuildFreeSlots();
+}
+
+/*	Tombstones free entries starting from the back of the pool, in a single pass. 
+	The free list is left stale, callers rebuild it once they are done. 
+	@param: InNumWantingToRemove: The number of entries we want to remove. 
+	@return: the number of entries that were removed. 
+*/
+int32 FManagedProjectileSubPool::TombstoneFreeEntries(int32 InNumWantingToRemove)
+{
+	int32 NumRemoved = 0;
+
+	// start at the back, so the trim after can drop as much of the pool as possible. 
+	for (int32 i = Entries.Num() - 1; i >= 0 && NumRemoved < InNumWantingToRemove; i--)
+	{
+		if (Slots.GetStateAt(i) == EProjectilePoolSlotState::Free)
+		{
+			TombstoneEntry(i);
+			NumRemoved++;
+		}
+	}
+
+	return NumRemoved;
+}
+
+/*	Destroys the projectile in an entry, the slot stays so no other entry moves. 
+	@param: InEntryIndex: The index of the entry to tombstone. 
+*/
+void FManagedProjectileSubPool::TombstoneEntry(int32 InEntryIndex)
+{
+	if (Entries[InEntryIndex].IsValid()) PROJECTILE_COUNT_STAT(Destroyed, 1);
+	Entries[InEntryIndex].CleanUpEntry();
+	Entries[InEntryIndex].UnMarkEntryInUse();
+	Slots.EmptySlot(InEntryIndex);
+}
+
+/* Drops the tombstones from the back of the pool, each tombstone is only ever trimmed once. */
+void FManagedProjectileSubPool::TrimTrailingTombstones()
+{
+	Slots.TrimTrailingEmptySlots();
+	Entries.SetNum(Slots.GetCapacity(), false);
+}
+
+/*	Resolves a handle to the entry it was issued for. 
+	@param: InHandle: The handle to resolve, already known to be for this pool. 
+	@return: the index of the entry, -1 if the handle is stale, returned already, or out of range.
+*/
+int32 FManagedProjectileSubPool::ResolveHandle(const FProjectileHandle& InHandle) const
+{
+	return Slots.IsAlive(FManagedProjectileSlotPool::FHandle(InHandle.GetSlotIndex(), InHandle.GetGeneration())) ? InHandle.GetSlotIndex() : INDEX_NONE;
+}
+
+/* Destroys every projectile in the pool and resets it to empty. */
+void FManagedProjectileSubPool::CleanUp()
+{
+	for (FManagedProjectileEntry& Record : Entries)
+	{
+		if (Record.IsValid()) PROJECTILE_COUNT_STAT(Destroyed, 1);
+		Record.CleanUpEntry();
+	}
+
+	Entries.Empty();
+	Slots.Reset();
+	PendingRemovalCount = 0;
+	PendingCreationTarget = 0;
+}
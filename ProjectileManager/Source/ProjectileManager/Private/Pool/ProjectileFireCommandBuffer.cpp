@@ -0,0 +1,70 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Pool/ProjectileFireCommandBuffer.h"
+#include "Misc/ScopeLock.h"
+
+//-----------------------------------------------------------------------------------
+// Projectile Fire Command Buffer Methods											-
+//-----------------------------------------------------------------------------------
+/*	Appends one command. 
+	@param: InCommand: The command, moved into the buffer.
+*/
+void FProjectileFireCommandBuffer::Append(FProjectileFireCommand&& InCommand)
+{
+	FScopeLock Lock(&PendingLock);
+	PendingCommands.Add(MoveTemp(InCommand));
+}
+
+/*	Appends a batch of commands under one lock. 
+	@param: InOutCommands: The commands, moved into the buffer and left empty.
+*/
+void FProjectileFireCommandBuffer::Append(TArray<FProjectileFireCommand>& InOutCommands)
+{
+	{
+		FScopeLock Lock(&PendingLock);
+		PendingCommands.Reserve(PendingCommands.Num() + InOutCommands.Num());
+
+		for (FProjectileFireCommand& Command : InOutCommands)
+		{
+			PendingCommands.Add(MoveTemp(Command));
+		}
+	}
+
+	InOutCommands.Reset();
+}
+
+/* Gets the number of commands waiting. */
+int32 FProjectileFireCommandBuffer::Num() const
+{
+	FScopeLock Lock(&PendingLock);
+	return PendingCommands.Num();
+}
+
+/*	Takes every waiting command in one swap. 
+	@param: OutCommands: Receives the commands, its old allocation becomes the new buffer.
+	@returns: the number of commands taken.
+*/
+int32 FProjectileFireCommandBuffer::TakePending(TArray<FProjectileFireCommand>& OutCommands)
+{
+	OutCommands.Reset();
+
+	FScopeLock Lock(&PendingLock);
+	Swap(PendingCommands, OutCommands);
+	return OutCommands.Num();
+}
@@ -0,0 +1,83 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Pool/ProjectileFreeSlotStack.h"
+
+//-----------------------------------------------------------------------------------
+// Projectile Free Slot Stack Lock Free Methods										-
+//-----------------------------------------------------------------------------------
+/*	Pushes a free slot, the link is written before the head is swung so a pop that sees the 
+	new head always sees the link. 
+	@param: InSlot: The slot that is now free.
+*/
+void FProjectileFreeSlotStack::Push(int32 InSlot)
+{
+	int64 Seen = FPlatformAtomics::AtomicRead(&Head);
+
+	for (;;)
+	{
+		FPlatformAtomics::AtomicStore(&Links[InSlot], GetHeadSlot(Seen));
+
+		const int64 Previous = FPlatformAtomics::InterlockedCompareExchange(&Head, PackHead(InSlot, GetHeadTag(Seen) + 1), Seen);
+		if (Previous == Seen) break;
+
+		Seen = Previous;
+	}
+
+	FPlatformAtomics::InterlockedIncrement(&NumFree);
+}
+
+/*	Pops a free slot. 
+	@returns: the slot, INDEX_NONE when the stack is empty.
+*/
+int32 FProjectileFreeSlotStack::Pop()
+{
+	int64 Seen = FPlatformAtomics::AtomicRead(&Head);
+
+	for (;;)
+	{
+		const int32 Slot = GetHeadSlot(Seen);
+		if (Slot == INDEX_NONE) return INDEX_NONE;
+
+		// the link may already be stale, the tag makes the exchange fail if it is. 
+		const int32 NextSlot = FPlatformAtomics::AtomicRead(&Links[Slot]);
+
+		const int64 Previous = FPlatformAtomics::InterlockedCompareExchange(&Head, PackHead(NextSlot, GetHeadTag(Seen) + 1), Seen);
+		if (Previous == Seen)
+		{
+			FPlatformAtomics::InterlockedDecrement(&NumFree);
+			return Slot;
+		}
+
+		Seen = Previous;
+	}
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Free Slot Stack Exclusive Methods										-
+//-----------------------------------------------------------------------------------
+/*	Empties the stack, every link is cleared. 
+	@param: InCapacity: The number of slots the links cover.
+*/
+void FProjectileFreeSlotStack::Reset(int32 InCapacity)
+{
+	Links.Reset();
+	Links.Init(INDEX_NONE, InCapacity);
+	Head = PackHead(INDEX_NONE, GetHeadTag(Head) + 1);
+	NumFree = 0;
+}
@@ -1,117 +1,263 @@
-/*	Copyright / License  Disclaimer
-*	MIT Copyright 2020 Nicholas Mallonee
-*	Permission is hereby granted, free of charge, to any person obtaining a
-*	copy of this software and associated documentation files(the "Software"), to deal
-*	in the Software without restriction, including without limitation the rights to use,
-*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
-*	Software, and to permit persons to whom the Software is furnished to do so, subject
-*	to the following conditions :
-*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
-*
-*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
-*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
-*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
-*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
-*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
-*	OTHER DEALINGS IN THE SOFTWARE.
-*/
-
-#include "ProjectileManager/Public/Projectile/ManagedProjectileBase.h"
-#include "Kismet/KismetMathLibrary.h"
-
-//-----------------------------------------------------------------------------------
-// Managed Projectile Base Class Constructor										-
-//-----------------------------------------------------------------------------------
-AManagedProjectileBase::AManagedProjectileBase()
-{
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.bStartWithTickEnabled = true;
-	PrimaryActorTick.bRunOnAnyThread = false;
-
-	// -- sphere comp
-	SphereCollision = CreateDefaultSubobject<USphereComponent>(TEXT("Collision Sphere"));
-	SphereCollision->InitSphereRadius(32.f);
-	RootComponent = SphereCollision;
-
-	// -- Movement comp set up
-	ProjectileMovement = CreateDefaultSubobject<UProjectileMovementComponent>(TEXT("Projectile Movement Comp"));
-	ProjectileMovement->UpdatedComponent = RootComponent;
-	ProjectileMovement->InitialSpeed = 0.f;
-	ProjectileMovement->MaxSpeed = 1000.f;
-	ProjectileMovement->bRotationFollowsVelocity = true;
-	ProjectileMovement->bShouldBounce = false;
-}
-
-//-----------------------------------------------------------------------------------
-// Managed Projectile Base Class Engine Events										-
-//-----------------------------------------------------------------------------------
-/* Engine Begin Play Event */
-void AManagedProjectileBase::BeginPlay()
-{
-	Super::BeginPlay();
-}
-
-/* Engine Tick Event */
-void AManagedProjectileBase::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-}
-
-//-----------------------------------------------------------------------------------
-// Managed Projectile Base Class Lifecycle Methods									-
-//-----------------------------------------------------------------------------------
-
-/*	Lifecycle method for projectiles when the pool wants to update this projectile.
-	@param: Settings: The settings coming in the request method
-	@returns: if the projectile handled the update successfully.
-*/
-bool AManagedProjectileBase::Request_UpdateFromPool(FProjectilePoolRequest Settings)
-{
-	if (!ProjectileMovement || !SphereCollision) return false;
-	else
-	{
-		// set the velocity. 
-		ProjectileMovement->Velocity = (Settings.GetProjectileSpeed() <= 0.f ? FVector::ZeroVector : Settings.GetDirectionVector() * Settings.GetProjectileSpeed());
-
-		// set the actor location and rotation.
-		SetActorLocationAndRotation(Settings.GetStartLocation(), Settings.GetDirectionVector().ToOrientationQuat(), !Settings.GetTeleportOnMove(), nullptr, ETeleportType::TeleportPhysics);
-
-		// set the collision to which ever state should be required. 
-		SphereCollision->SetCollisionEnabled(Settings.GetCollisionEnabledSettings());	
-
-		// enable or disable the tick after the move?
-		SetActorTickEnabled(Settings.GetEnableTick());
-
-		// disable or enable the tick on the movement component after the move?
-		ProjectileMovement->SetComponentTickEnabled(Settings.GetEnableTick());
-
-		// do we show or hide the projectile after the move? 
-		SetActorHiddenInGame(Settings.GetHideAfterPoolRequest());
-
-		return true;
-	}
-}
-
-/*	Lifecycle method to destroy the projectile. 
-	@returns: if the projectile was destroyed. 
-*/
-bool AManagedProjectileBase::Deinit_ProjectileBase()
-{
-	return Destroy();
-}
-
-/* Used to set the projectile movement component to tick async or inline with the game/ physics thread. 
-	@param: bNewState: do we tick async? 
-	@returns: if it completed successfully
-*/
-bool AManagedProjectileBase::Requst_TickMoveToAsync(bool bNewState)
-{
-	if (ProjectileMovement)
-	{
-		ProjectileMovement->SetComponentTickEnabledAsync(bNewState);
-		return true;
-	}
-	else
-		return false;
-}
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ProjectileManager/Public/Projectile/ManagedProjectileBase.h"
+#include "ProjectileManager/Public/Stats/ProjectileManagerStats.h"
+#include "Kismet/KismetMathLibrary.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+int32 FProjectilePoolStateSetCounts::NumCollisionSets = 0;
+int32 FProjectilePoolStateSetCounts::NumTickSets = 0;
+int32 FProjectilePoolStateSetCounts::NumHiddenSets = 0;
+
+/* Counts a pool state setter in the stats group, and for the benchmark */
+#define PROJECTILE_COUNT_POOL_STATE_SET(Name) \
+	do { PROJECTILE_COUNT_STAT(Name, 1); FProjectilePoolStateSetCounts::Num##Name++; } while (0)
+#else
+#define PROJECTILE_COUNT_POOL_STATE_SET(Name) PROJECTILE_COUNT_STAT(Name, 1)
+#endif
+
+//-----------------------------------------------------------------------------------
+// Managed Projectile Base Class Constructor										-
+//-----------------------------------------------------------------------------------
+AManagedProjectileBase::AManagedProjectileBase()
+{
+ 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = true;
+	PrimaryActorTick.bRunOnAnyThread = false;
+
+	// -- sphere comp
+	SphereCollision = CreateDefaultSubobject<USphereComponent>(TEXT("Collision Sphere"));
+	SphereCollision->InitSphereRadius(32.f);
+	RootComponent = SphereCollision;
+
+	// -- Movement comp set up
+	ProjectileMovement = CreateDefaultSubobject<UProjectileMovementComponent>(TEXT("Projectile Movement Comp"));
+	ProjectileMovement->UpdatedComponent = RootComponent;
+	ProjectileMovement->InitialSpeed = 0.f;
+	ProjectileMovement->MaxSpeed = 1000.f;
+	ProjectileMovement->bRotationFollowsVelocity = true;
+	ProjectileMovement->bShouldBounce = false;
+}
+
+//-----------------------------------------------------------------------------------
+// Managed Projectile Base Class Engine Events										-
+//-----------------------------------------------------------------------------------
+/* Engine Begin Play Event */
+void AManagedProjectileBase::BeginPlay()
+{
+	Super::BeginPlay();
+}
+
+/* Engine Tick Event */
+void AManagedProjectileBase::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+}
+
+//-----------------------------------------------------------------------------------
+// Managed Projectile Base Class Lifecycle Methods									-
+//-----------------------------------------------------------------------------------
+
+/*	Lifecycle method for projectiles when the pool wants to update this projectile. 
+	Collision changes recreate the physics state and visibility changes dirty the render state, 
+	so only what differs from the last applied request is set. 
+	@param: Settings: The settings coming in the request method
+	@returns: if the projectile handled the update successfully.
+*/
+bool AManagedProjectileBase::Request_UpdateFromPool(const FProjectilePoolRequest& Settings)
+{
+	PROJECTILE_SCOPE_STAT(UpdateFromPool);
+
+	if (!ProjectileMovement || !SphereCollision) return false;
+	else
+	{
+		// set the velocity. 
+		ProjectileMovement->Velocity = (Settings.GetProjectileSpeed() <= 0.f ? FVector::ZeroVector : Settings.GetDirectionVector() * Settings.GetProjectileSpeed());
+
+		// set the actor location and rotation.
+		SetActorLocationAndRotation(Settings.GetStartLocation(), Settings.GetDirectionVector().ToOrientationQuat(), !Settings.GetTeleportOnMove(), nullptr, ETeleportType::TeleportPhysics);
+
+		// set the collision to which ever state should be required. 
+		if (AppliedPoolState.NeedsCollision(Settings.GetCollisionEnabledSettings()))
+		{
+			SphereCollision->SetCollisionEnabled(Settings.GetCollisionEnabledSettings());
+			AppliedPoolState.CollisionSettings = Settings.GetCollisionEnabledSettings();
+			PROJECTILE_COUNT_POOL_STATE_SET(CollisionSets);
+		}
+
+		// enable or disable the tick after the move? the manager reads it when it owns the tick.
+		if (IsTickedByManager())
+		{
+			bBatchTickEnabled = Settings.GetEnableTick();
+			BatchStepPendingTime = 0.f;
+		}
+		else if (AppliedPoolState.NeedsTick(Settings.GetEnableTick()))
+		{
+			SetActorTickEnabled(Settings.GetEnableTick());
+
+			// disable or enable the tick on the movement component after the move?
+			ProjectileMovement->SetComponentTickEnabled(Settings.GetEnableTick());
+			PROJECTILE_COUNT_POOL_STATE_SET(TickSets);
+		}
+		AppliedPoolState.bTickEnabled = Settings.GetEnableTick();
+
+		// do we show or hide the projectile after the move? 
+		if (AppliedPoolState.NeedsHidden(Settings.GetHideAfterPoolRequest()))
+		{
+			SetActorHiddenInGame(Settings.GetHideAfterPoolRequest());
+			AppliedPoolState.bHidden = Settings.GetHideAfterPoolRequest();
+			PROJECTILE_COUNT_POOL_STATE_SET(HiddenSets);
+		}
+
+		AppliedPoolState.bIsValid = true;
+		return true;
+	}
+}
+
+/*	Lifecycle method to destroy the projectile. 
+	@returns: if the projectile was destroyed. 
+*/
+bool AManagedProjectileBase::Deinit_ProjectileBase()
+{
+	return Destroy();
+}
+
+/*	Hands the tick over to the manager, or back to the projectile. 
+	@param: bNewState: does the manager tick this projectile? 
+*/
+void AManagedProjectileBase::SetTickedByManager(bool bNewState)
+{
+	bTickedByManager = bNewState;
+	bBatchTickEnabled = bNewState && IsActorTickEnabled();
+
+	// the tick functions are set here, the applied state no longer matches them. 
+	AppliedPoolState.Invalidate();
+
+	// the per actor tick functions are never dispatched while the manager ticks us. 
+	SetActorTickEnabled(!bNewState);
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->SetComponentTickEnabled(!bNewState);
+	}
+}
+
+/*	The manager batched update, steps the movement component directly. A reduced rate projectile 
+	saves the frame time up and covers it in one larger step once its interval has passed. 
+	@param: DeltaTime: The frame time.
+	@returns: if the movement was stepped.
+*/
+bool AManagedProjectileBase::Tick_Batched(float DeltaTime)
+{
+	if (!bBatchTickEnabled || bIsParked || !ProjectileMovement) return false;
+
+	BatchStepPendingTime += DeltaTime;
+	if (BatchStepPendingTime < SimulationStepInterval) return false;
+
+	ProjectileMovement->TickComponent(BatchStepPendingTime * CustomTimeDilation, LEVELTICK_All, &ProjectileMovement->PrimaryComponentTick);
+	BatchStepPendingTime = 0.f;
+	return true;
+}
+
+/*	Sets the seconds between movement steps. The batched tick reads it, otherwise it becomes 
+	the tick interval of the actor and the movement, which are handed the time since they last 
+	ticked so a step covers the whole interval. 
+	@param: InInterval: The seconds between steps, 0 steps every frame.
+*/
+void AManagedProjectileBase::SetSimulationStepInterval(float InInterval)
+{
+	SimulationStepInterval = FMath::Max(InInterval, 0.f);
+
+	if (!IsTickedByManager())
+	{
+		SetActorTickInterval(SimulationStepInterval);
+		if (ProjectileMovement) ProjectileMovement->SetComponentTickInterval(SimulationStepInterval);
+	}
+}
+
+/*	Parks the projectile by unregistering its registered components. A parked projectile has no 
+	physics body in the broadphase, no scene proxy and no component tick, so a large idle pool 
+	costs the scenes nothing. Pool requests can still be applied, they only set the values. 
+*/
+void AManagedProjectileBase::Request_Park()
+{
+	if (bIsParked) return;
+
+	TInlineComponentArray<UActorComponent*> Components(this);
+	ParkedComponents.Reset(Components.Num());
+
+	for (UActorComponent* Component : Components)
+	{
+		if (Component && Component->IsRegistered())
+		{
+			ParkedComponents.Add(Component);
+		}
+	}
+
+	// the root registers first on unpark, so the attached components find it registered. 
+	const int32 RootIndex = ParkedComponents.Find(GetRootComponent());
+	if (RootIndex > 0) ParkedComponents.Swap(0, RootIndex);
+
+	for (UActorComponent* Component : ParkedComponents)
+	{
+		Component->UnregisterComponent();
+	}
+
+	bIsParked = true;
+}
+
+/*	Unparks the projectile by registering the parked components again. The physics and render 
+	states are created once, at the transform and collision the pull request already set. 
+*/
+void AManagedProjectileBase::Request_Unpark()
+{
+	if (!bIsParked) return;
+
+	for (UActorComponent* Component : ParkedComponents)
+	{
+		if (Component && !Component->IsRegistered())
+		{
+			Component->RegisterComponent();
+		}
+	}
+
+	ParkedComponents.Reset();
+	bIsParked = false;
+
+	// registering enables tick functions that start enabled, put back what the pool request asked for. 
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->SetComponentTickEnabled(!IsTickedByManager() && AppliedPoolState.bTickEnabled);
+	}
+}
+
+/* Used to set the projectile movement component to tick async or inline with the game/ physics thread. 
+	@param: bNewState: do we tick async? 
+	@returns: if it completed successfully
+*/
+bool AManagedProjectileBase::Requst_TickMoveToAsync(bool bNewState)
+{
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->SetComponentTickEnabledAsync(bNewState);
+		return true;
+	}
+	else
+		return false;
+}
@@ -0,0 +1,203 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Simulation/ProjectileBallisticKernel.h"
+
+//-----------------------------------------------------------------------------------
+// Projectile Ballistic Kernel Integration											-
+//-----------------------------------------------------------------------------------
+/*	The reference integration, one projectile at a time. 
+	@param: Data: The simulation data to integrate.
+	@param: StartIndex: The first dense index to integrate.
+	@param: Count: The number of projectiles to integrate.
+	@param: DeltaTime: The time to advance by.
+	@param: Params: The gravity, drag and max speed.
+*/
+void FProjectileBallisticKernel::Integrate_Scalar(FProjectileSimulationData& Data, int32 StartIndex, int32 Count, float DeltaTime, const FProjectileBallisticParams& Params)
+{
+	float* RESTRICT PX = Data.PositionsX.GetData() + StartIndex;
+	float* RESTRICT PY = Data.PositionsY.GetData() + StartIndex;
+	float* RESTRICT PZ = Data.PositionsZ.GetData() + StartIndex;
+	float* RESTRICT VX = Data.VelocitiesX.GetData() + StartIndex;
+	float* RESTRICT VY = Data.VelocitiesY.GetData() + StartIndex;
+	float* RESTRICT VZ = Data.VelocitiesZ.GetData() + StartIndex;
+	float* RESTRICT Ages = Data.Ages.GetData() + StartIndex;
+
+	const FVector GravityStep = Params.Gravity * DeltaTime;
+	const float DragScale = FMath::Max(0.f, 1.f - Params.LinearDrag * DeltaTime);
+	const bool bClampSpeed = Params.MaxSpeed > 0.f;
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		float X = (VX[i] + GravityStep.X) * DragScale;
+		float Y = (VY[i] + GravityStep.Y) * DragScale;
+		float Z = (VZ[i] + GravityStep.Z) * DragScale;
+
+		if (bClampSpeed)
+		{
+			// the epsilon keeps a resting projectile from dividing by zero, it matches the vectorized path. 
+			const float Scale = FMath::Min(1.f, Params.MaxSpeed / FMath::Sqrt(X * X + Y * Y + Z * Z + SMALL_NUMBER));
+			X *= Scale;
+			Y *= Scale;
+			Z *= Scale;
+		}
+
+		VX[i] = X;
+		VY[i] = Y;
+		VZ[i] = Z;
+
+		PX[i] += X * DeltaTime;
+		PY[i] += Y * DeltaTime;
+		PZ[i] += Z * DeltaTime;
+
+		Ages[i] += DeltaTime;
+	}
+}
+
+/*	The vectorized integration, four projectiles are loaded per axis into one register. 
+	@param: Data: The simulation data to integrate.
+	@param: StartIndex: The first dense index to integrate.
+	@param: Count: The number of projectiles to integrate.
+	@param: DeltaTime: The time to advance by.
+	@param: Params: The gravity, drag and max speed.
+*/
+void FProjectileBallisticKernel::Integrate_Vectorized(FProjectileSimulationData& Data, int32 StartIndex, int32 Count, float DeltaTime, const FProjectileBallisticParams& Params)
+{
+	float* RESTRICT PX = Data.PositionsX.GetData() + StartIndex;
+	float* RESTRICT PY = Data.PositionsY.GetData() + StartIndex;
+	float* RESTRICT PZ = Data.PositionsZ.GetData() + StartIndex;
+	float* RESTRICT VX = Data.VelocitiesX.GetData() + StartIndex;
+	float* RESTRICT VY = Data.VelocitiesY.GetData() + StartIndex;
+	float* RESTRICT VZ = Data.VelocitiesZ.GetData() + StartIndex;
+	float* RESTRICT Ages = Data.Ages.GetData() + StartIndex;
+
+	const VectorRegister VDeltaTime = VectorSetFloat1(DeltaTime);
+	const VectorRegister VGravityX = VectorSetFloat1(Params.Gravity.X * DeltaTime);
+	const VectorRegister VGravityY = VectorSetFloat1(Params.Gravity.Y * DeltaTime);
+	const VectorRegister VGravityZ = VectorSetFloat1(Params.Gravity.Z * DeltaTime);
+	const VectorRegister VDragScale = VectorSetFloat1(FMath::Max(0.f, 1.f - Params.LinearDrag * DeltaTime));
+	const VectorRegister VMaxSpeed = VectorSetFloat1(Params.MaxSpeed);
+	const VectorRegister VEpsilon = VectorSetFloat1(SMALL_NUMBER);
+	const VectorRegister VOne = VectorOne();
+	const bool bClampSpeed = Params.MaxSpeed > 0.f;
+
+	// the data is split per axis, so lane n of every register is the same projectile. 
+	const int32 NumVectorized = Count & ~3;
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		VectorRegister X = VectorMultiply(VectorAdd(VectorLoad(VX + i), VGravityX), VDragScale);
+		VectorRegister Y = VectorMultiply(VectorAdd(VectorLoad(VY + i), VGravityY), VDragScale);
+		VectorRegister Z = VectorMultiply(VectorAdd(VectorLoad(VZ + i), VGravityZ), VDragScale);
+
+		if (bClampSpeed)
+		{
+			const VectorRegister SpeedSquared = VectorMultiplyAdd(X, X, VectorMultiplyAdd(Y, Y, VectorMultiplyAdd(Z, Z, VEpsilon)));
+			const VectorRegister Scale = VectorMin(VOne, VectorMultiply(VMaxSpeed, VectorReciprocalSqrtAccurate(SpeedSquared)));
+			X = VectorMultiply(X, Scale);
+			Y = VectorMultiply(Y, Scale);
+			Z = VectorMultiply(Z, Scale);
+		}
+
+		VectorStore(X, VX + i);
+		VectorStore(Y, VY + i);
+		VectorStore(Z, VZ + i);
+
+		VectorStore(VectorMultiplyAdd(X, VDeltaTime, VectorLoad(PX + i)), PX + i);
+		VectorStore(VectorMultiplyAdd(Y, VDeltaTime, VectorLoad(PY + i)), PY + i);
+		VectorStore(VectorMultiplyAdd(Z, VDeltaTime, VectorLoad(PZ + i)), PZ + i);
+
+		VectorStore(VectorAdd(VectorLoad(Ages + i), VDeltaTime), Ages + i);
+	}
+
+	// finish what doesnt fill a register. 
+	if (NumVectorized < Count)
+	{
+		Integrate_Scalar(Data, StartIndex + NumVectorized, Count - NumVectorized, DeltaTime, Params);
+	}
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Ballistic Kernel Orientation											-
+//-----------------------------------------------------------------------------------
+/*	The reference orientation, the same FVector::ToOrientationQuat the actor pool uses. 
+	@param: Data: The simulation data to update.
+	@param: StartIndex: The first dense index to update.
+	@param: Count: The number of projectiles to update.
+*/
+void FProjectileBallisticKernel::ComputeOrientations_Scalar(FProjectileSimulationData& Data, int32 StartIndex, int32 Count)
+{
+	for (int32 i = StartIndex, End = StartIndex + Count; i < End; i++)
+	{
+		Data.Orientations[i] = Data.GetVelocity(i).ToOrientationQuat();
+	}
+}
+
+/*	The vectorized orientation, yaw and pitch for four projectiles are turned into a quat per lane. 
+	@param: Data: The simulation data to update.
+	@param: StartIndex: The first dense index to update.
+	@param: Count: The number of projectiles to update.
+*/
+void FProjectileBallisticKernel::ComputeOrientations_Vectorized(FProjectileSimulationData& Data, int32 StartIndex, int32 Count)
+{
+	const float* RESTRICT VX = Data.VelocitiesX.GetData() + StartIndex;
+	const float* RESTRICT VY = Data.VelocitiesY.GetData() + StartIndex;
+	const float* RESTRICT VZ = Data.VelocitiesZ.GetData() + StartIndex;
+	FQuat* RESTRICT Orientations = Data.Orientations.GetData() + StartIndex;
+
+	const VectorRegister VHalf = VectorSetFloat1(0.5f);
+	const VectorRegister VEpsilon = VectorSetFloat1(SMALL_NUMBER);
+
+	MS_ALIGN(16) float QuatX[4] GCC_ALIGN(16);
+	MS_ALIGN(16) float QuatY[4] GCC_ALIGN(16);
+	MS_ALIGN(16) float QuatZ[4] GCC_ALIGN(16);
+	MS_ALIGN(16) float QuatW[4] GCC_ALIGN(16);
+
+	const int32 NumVectorized = Count & ~3;
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		const VectorRegister X = VectorLoad(VX + i);
+		const VectorRegister Y = VectorLoad(VY + i);
+		const VectorRegister Z = VectorLoad(VZ + i);
+
+		// yaw around z, pitch up from the horizontal length, no roll. 
+		const VectorRegister HorizontalLength = VectorReciprocal(VectorReciprocalSqrtAccurate(VectorMultiplyAdd(X, X, VectorMultiplyAdd(Y, Y, VEpsilon))));
+		const VectorRegister HalfYaw = VectorMultiply(VectorATan2(Y, X), VHalf);
+		const VectorRegister HalfPitch = VectorMultiply(VectorATan2(Z, HorizontalLength), VHalf);
+
+		VectorRegister SinYaw, CosYaw, SinPitch, CosPitch;
+		VectorSinCos(&SinYaw, &CosYaw, &HalfYaw);
+		VectorSinCos(&SinPitch, &CosPitch, &HalfPitch);
+
+		VectorStoreAligned(VectorMultiply(SinPitch, SinYaw), QuatX);
+		VectorStoreAligned(VectorNegate(VectorMultiply(SinPitch, CosYaw)), QuatY);
+		VectorStoreAligned(VectorMultiply(CosPitch, SinYaw), QuatZ);
+		VectorStoreAligned(VectorMultiply(CosPitch, CosYaw), QuatW);
+
+		// back to one quat per projectile. 
+		for (int32 Lane = 0; Lane < 4; Lane++)
+		{
+			Orientations[i + Lane] = FQuat(QuatX[Lane], QuatY[Lane], QuatZ[Lane], QuatW[Lane]);
+		}
+	}
+
+	// finish what doesnt fill a register. 
+	if (NumVectorized < Count)
+	{
+		ComputeOrientations_Scalar(Data, StartIndex + NumVectorized, Count - NumVectorized);
+	}
+}
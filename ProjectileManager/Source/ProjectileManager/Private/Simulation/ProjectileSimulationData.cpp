@@ -0,0 +1,168 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Simulation/ProjectileSimulationData.h"
+
+//-----------------------------------------------------------------------------------
+// Projectile Simulation Data Methods												-
+//-----------------------------------------------------------------------------------
+/*	Clears the data and allocates the slots up front so firing never allocates. 
+	@param: InCapacity: The number of projectiles that can be live at once.
+*/
+void FProjectileSimulationData::Initialize(int32 InCapacity)
+{
+	Reset();
+	Grow(InCapacity);
+}
+
+/*	Adds free slots up to the new capacity. 
+	@param: InNewCapacity: The new number of slots.
+	@returns: if any slots were added.
+*/
+bool FProjectileSimulationData::Grow(int32 InNewCapacity)
+{
+	const int32 OldCapacity = GetCapacity();
+	if (InNewCapacity <= OldCapacity) return false;
+	else
+	{
+		PositionsX.Reserve(InNewCapacity);
+		PositionsY.Reserve(InNewCapacity);
+		PositionsZ.Reserve(InNewCapacity);
+		VelocitiesX.Reserve(InNewCapacity);
+		VelocitiesY.Reserve(InNewCapacity);
+		VelocitiesZ.Reserve(InNewCapacity);
+		Orientations.Reserve(InNewCapacity);
+		Ages.Reserve(InNewCapacity);
+		CollisionRadii.Reserve(InNewCapacity);
+		Owners.Reserve(InNewCapacity);
+		Flags.Reserve(InNewCapacity);
+		DenseToSlot.Reserve(InNewCapacity);
+		Slots.Reserve(InNewCapacity);
+
+		return true;
+	}
+}
+
+/* Empties every array. */
+void FProjectileSimulationData::Reset()
+{
+	PositionsX.Empty();
+	PositionsY.Empty();
+	PositionsZ.Empty();
+	VelocitiesX.Empty();
+	VelocitiesY.Empty();
+	VelocitiesZ.Empty();
+	Orientations.Empty();
+	Ages.Empty();
+	CollisionRadii.Empty();
+	Owners.Empty();
+	Flags.Empty();
+	DenseToSlot.Empty();
+	Slots.Reset();
+}
+
+/*	Adds a projectile to the back of the dense arrays. 
+	@param: InRequest: The fire settings, location, direction, speed and collision are used.
+	@param: InCollisionRadius: The radius used for the projectiles collision.
+	@param: OutHandle: The issued handle.
+	@returns: if there was a free slot.
+*/
+bool FProjectileSimulationData::Add(const FProjectilePoolRequest& InRequest, float InCollisionRadius, FProjectileHandle& OutHandle)
+{
+	if (!HasFreeSlot())
+	{
+		OutHandle.Reset();
+		return false;
+	}
+	else
+	{
+		const int32 DenseIndex = Num();
+		const FProjectileSimulationSlotPool::FHandle SlotHandle = Slots.Acquire(DenseIndex);
+		const FVector Location = InRequest.GetStartLocation();
+		const FVector Velocity = InRequest.GetProjectileSpeed() <= 0.f ? FVector::ZeroVector : InRequest.GetDirectionVector() * InRequest.GetProjectileSpeed();
+
+		PositionsX.Add(Location.X);
+		PositionsY.Add(Location.Y);
+		PositionsZ.Add(Location.Z);
+		VelocitiesX.Add(Velocity.X);
+		VelocitiesY.Add(Velocity.Y);
+		VelocitiesZ.Add(Velocity.Z);
+		Orientations.Add(InRequest.GetDirectionVector().ToOrientationQuat());
+		Ages.Add(0.f);
+		CollisionRadii.Add(InCollisionRadius);
+		Owners.Add(InRequest.GetOwningActor());
+
+		uint8 NewFlags = EProjectileSimulationFlags::None;
+		if (InRequest.GetCollisionEnabledSettings() != ECollisionEnabled::NoCollision) NewFlags |= EProjectileSimulationFlags::CollisionEnabled;
+		if (InRequest.GetHideAfterPoolRequest()) NewFlags |= EProjectileSimulationFlags::Hidden;
+		Flags.Add(NewFlags);
+
+		DenseToSlot.Add(SlotHandle.Index);
+
+		// the slot generations are unsigned so they can wrap, the handle carries the same bits. 
+		OutHandle = FProjectileHandle(SlotHandle.Index, int32(SlotHandle.Generation));
+		return true;
+	}
+}
+
+/*	Resolves a handle to the dense index of its projectile. 
+	@param: InHandle: The handle to resolve.
+	@returns: the dense index, -1 if the handle is stale or was never issued.
+*/
+int32 FProjectileSimulationData::ResolveHandle(const FProjectileHandle& InHandle) const
+{
+	const int32* DenseIndex = Slots.Resolve(FProjectileSimulationSlotPool::FHandle(InHandle.GetSlotIndex(), uint32(InHandle.GetGeneration())));
+	return DenseIndex ? *DenseIndex : INDEX_NONE;
+}
+
+/* Gets the handle of a live projectile. */
+FProjectileHandle FProjectileSimulationData::GetHandle(int32 DenseIndex) const
+{
+	const FProjectileSimulationSlotPool::FHandle SlotHandle = Slots.GetHandleAt(DenseToSlot[DenseIndex]);
+	return FProjectileHandle(SlotHandle.Index, int32(SlotHandle.Generation));
+}
+
+/*	Removes a live projectile, the last live projectile fills the gap so the data stays packed. 
+	@param: DenseIndex: The dense index of the projectile to remove.
+*/
+void FProjectileSimulationData::RemoveAtDense(int32 DenseIndex)
+{
+	const int32 Slot = DenseToSlot[DenseIndex];
+
+	PositionsX.RemoveAtSwap(DenseIndex, 1, false);
+	PositionsY.RemoveAtSwap(DenseIndex, 1, false);
+	PositionsZ.RemoveAtSwap(DenseIndex, 1, false);
+	VelocitiesX.RemoveAtSwap(DenseIndex, 1, false);
+	VelocitiesY.RemoveAtSwap(DenseIndex, 1, false);
+	VelocitiesZ.RemoveAtSwap(DenseIndex, 1, false);
+	Orientations.RemoveAtSwap(DenseIndex, 1, false);
+	Ages.RemoveAtSwap(DenseIndex, 1, false);
+	CollisionRadii.RemoveAtSwap(DenseIndex, 1, false);
+	Owners.RemoveAtSwap(DenseIndex, 1, false);
+	Flags.RemoveAtSwap(DenseIndex, 1, false);
+	DenseToSlot.RemoveAtSwap(DenseIndex, 1, false);
+
+	// point the moved projectiles slot at its new dense index. 
+	if (DenseIndex < Num())
+	{
+		Slots.GetItemAt(DenseToSlot[DenseIndex]) = DenseIndex;
+	}
+
+	// free the slot, its generation moves on so any handle to it goes stale. 
+	Slots.ReleaseAt(Slot);
+}
@@ -0,0 +1,61 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Stats/ProjectileManagerStats.h"
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Stats Definitions												-
+//-----------------------------------------------------------------------------------
+DEFINE_STAT(STAT_ProjectileAcquire);
+DEFINE_STAT(STAT_ProjectileAcquireBurst);
+DEFINE_STAT(STAT_ProjectileReturn);
+DEFINE_STAT(STAT_ProjectileReturnPass);
+DEFINE_STAT(STAT_ProjectileUpdateFromPool);
+DEFINE_STAT(STAT_ProjectileCreatePool);
+DEFINE_STAT(STAT_ProjectileSpawn);
+DEFINE_STAT(STAT_ProjectileResizePool);
+
+DEFINE_STAT(STAT_ProjectileAsyncCommands);
+DEFINE_STAT(STAT_ProjectileFireCommands);
+DEFINE_STAT(STAT_ProjectileBatchedTick);
+DEFINE_STAT(STAT_ProjectileSimulateData);
+DEFINE_STAT(STAT_ProjectileIssueSweeps);
+DEFINE_STAT(STAT_ProjectileConsumeSweeps);
+DEFINE_STAT(STAT_ProjectileExpiry);
+DEFINE_STAT(STAT_ProjectileSignificance);
+DEFINE_STAT(STAT_ProjectileInstanceUpdate);
+
+DEFINE_STAT(STAT_ProjectileAcquires);
+DEFINE_STAT(STAT_ProjectileReturns);
+DEFINE_STAT(STAT_ProjectileAcquireMisses);
+DEFINE_STAT(STAT_ProjectileAcquireFailures);
+DEFINE_STAT(STAT_ProjectileReturnMisses);
+DEFINE_STAT(STAT_ProjectileSpawned);
+DEFINE_STAT(STAT_ProjectileDestroyed);
+DEFINE_STAT(STAT_ProjectileCollisionSets);
+DEFINE_STAT(STAT_ProjectileTickSets);
+DEFINE_STAT(STAT_ProjectileHiddenSets);
+
+DEFINE_STAT(STAT_ProjectileInUse);
+DEFINE_STAT(STAT_ProjectilePoolSize);
+DEFINE_STAT(STAT_ProjectileRenderedInstances);
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager CSV Category Definition										-
+//-----------------------------------------------------------------------------------
+CSV_DEFINE_CATEGORY_MODULE(PROJECTILEMANAGER_API, ProjectileManager, true);
@@ -0,0 +1,107 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Subsystem/ProjectileManagerSubsystem.h"
+#include "ProjectileManager/Public/Manager/ProjectileManagerBase.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Subsystem Methods												-
+//-----------------------------------------------------------------------------------
+/*	Gets the subsystem of the context objects world. 
+	@param: ContextObject: The context object to get the world reference from.
+	@returns: the subsystem, nullptr if the context object has no world.
+*/
+UProjectileManagerSubsystem* UProjectileManagerSubsystem::Get(const UObject* ContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(ContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	return World ? World->GetSubsystem<UProjectileManagerSubsystem>() : nullptr;
+}
+
+/* Engine deinitialize event, drops every registration. */
+void UProjectileManagerSubsystem::Deinitialize()
+{
+	Managers.Empty();
+	ManagersByTag.Empty();
+	PrimaryManager = nullptr;
+
+	Super::Deinitialize();
+}
+
+/*	Registers a manager, the first manager registered is handed out by the untagged lookup. 
+	@param: InManager: The manager that started playing.
+*/
+void UProjectileManagerSubsystem::Request_RegisterManager(AProjectileManagerBase* InManager)
+{
+	if (!InManager || Managers.Contains(InManager)) return;
+
+	Managers.Add(InManager);
+	if (!PrimaryManager) PrimaryManager = InManager;
+
+	const FName ManagerTag = InManager->GetManagerTag();
+	if (ManagerTag.IsNone()) return;
+	else if (ManagersByTag.Contains(ManagerTag))
+	{
+		UE_LOG(LogClass, Error, TEXT("Projectile manager %s uses the tag %s, which is already used by %s. It is found by the tag once that manager stops playing."), *InManager->GetName(), *ManagerTag.ToString(), *GetNameSafe(ManagersByTag[ManagerTag]));
+	}
+	else
+	{
+		ManagersByTag.Add(ManagerTag, InManager);
+	}
+}
+
+/*	Unregisters a manager, the next manager in registration order takes over the untagged lookup, 
+	and the next one with the same tag takes over the tag. 
+	@param: InManager: The manager that stopped playing.
+*/
+void UProjectileManagerSubsystem::Request_UnregisterManager(AProjectileManagerBase* InManager)
+{
+	if (!InManager || Managers.Remove(InManager) <= 0) return;
+
+	const FName ManagerTag = InManager->GetManagerTag();
+	if (!ManagerTag.IsNone() && ManagersByTag.FindRef(ManagerTag) == InManager)
+	{
+		ManagersByTag.Remove(ManagerTag);
+
+		// a manager that was refused the tag while this one held it can be found by it now. 
+		for (AProjectileManagerBase* Manager : Managers)
+		{
+			if (Manager && Manager->GetManagerTag() == ManagerTag)
+			{
+				ManagersByTag.Add(ManagerTag, Manager);
+				break;
+			}
+		}
+	}
+
+	if (PrimaryManager == InManager)
+	{
+		PrimaryManager = Managers.Num() > 0 ? Managers[0] : nullptr;
+	}
+}
+
+/*	Gets the manager registered with a tag. 
+	@param: InManagerTag: The tag set in the managers init settings.
+	@returns: the manager, nullptr if no playing manager has the tag.
+*/
+AProjectileManagerBase* UProjectileManagerSubsystem::GetProjectileManagerByTag(FName InManagerTag) const
+{
+	return ManagersByTag.FindRef(InManagerTag);
+}
@@ -0,0 +1,215 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Pool/ProjectileFreeSlotStack.h"
+#include "ProjectileManager/Public/Manager/ProjectileManagerBase.h"
+#include "ProjectileManager/Public/Benchmark/ProjectileManagerBenchmark.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Queue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//-----------------------------------------------------------------------------------
+// Projectile Async Pool Tests														-
+//-----------------------------------------------------------------------------------
+/*	Hammers one free slot stack with pops and pushes from several task graph threads. Every 
+	popped slot is claimed with a compare exchange, a claim that finds the slot already held 
+	means two threads were handed the same slot. The stack has to hold every slot exactly once 
+	when the threads are done. 
+*/
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectileFreeSlotStackConcurrencyTest, "ProjectileManager.Pool.FreeSlotStack.ConcurrentPopPush", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectileFreeSlotStackConcurrencyTest::RunTest(const FString& Parameters)
+{
+	const int32 NumSlots = 256;
+	const int32 NumTasks = 8;
+	const int32 NumRounds = 100000;
+	const int32 MaxHeldPerTask = 16;
+
+	FProjectileFreeSlotStack Stack;
+	Stack.Reset(NumSlots);
+	for (int32 Slot = NumSlots - 1; Slot >= 0; Slot--) Stack.Push(Slot);
+
+	TArray<int32> Owners;
+	Owners.Init(0, NumSlots);
+	volatile int32 NumDuplicates = 0;
+
+	ParallelFor(NumTasks, [&Stack, &Owners, &NumDuplicates, NumRounds, MaxHeldPerTask](int32 TaskIndex)
+	{
+		FRandomStream Stream(TaskIndex + 1);
+		TArray<int32, TInlineAllocator<16>> Held;
+
+		for (int32 Round = 0; Round < NumRounds; Round++)
+		{
+			if (Held.Num() <= 0 || (Held.Num() < MaxHeldPerTask && Stream.RandHelper(2) == 0))
+			{
+				const int32 Slot = Stack.Pop();
+				if (Slot == INDEX_NONE) continue;
+
+				if (FPlatformAtomics::InterlockedCompareExchange(&Owners[Slot], 1, 0) != 0) FPlatformAtomics::InterlockedIncrement(&NumDuplicates);
+				Held.Add(Slot);
+			}
+			else
+			{
+				// let go of the claim before the push, the slot is anyones the moment it is pushed. 
+				const int32 Slot = Held[Stream.RandHelper(Held.Num())];
+				Held.RemoveSingleSwap(Slot);
+				FPlatformAtomics::InterlockedExchange(&Owners[Slot], 0);
+				Stack.Push(Slot);
+			}
+		}
+
+		for (int32 Slot : Held)
+		{
+			FPlatformAtomics::InterlockedExchange(&Owners[Slot], 0);
+			Stack.Push(Slot);
+		}
+	});
+
+	TestEqual(TEXT("No slot was popped by two threads at once"), int32(NumDuplicates), 0);
+	TestEqual(TEXT("Every slot is free once the threads are done"), Stack.Num(), NumSlots);
+
+	// every slot comes back exactly once. 
+	TArray<bool> Popped;
+	Popped.Init(false, NumSlots);
+	int32 NumPopped = 0;
+
+	for (int32 Slot = Stack.Pop(); Slot != INDEX_NONE; Slot = Stack.Pop())
+	{
+		if (!TestTrue(TEXT("Popped slot is in range"), Popped.IsValidIndex(Slot))) return false;
+
+		TestFalse(FString::Printf(TEXT("Slot %d is on the stack once"), Slot), Popped[Slot]);
+		Popped[Slot] = true;
+		NumPopped++;
+	}
+
+	TestEqual(TEXT("Every slot was on the stack"), NumPopped, NumSlots);
+	return true;
+}
+
+/*	Reserves projectiles with Request_GetProjectileAsync from several task graph threads while 
+	the game thread applies the reservations through the managers tick and returns them again. 
+	Every applied handle has to be alive, and no slot may be held by two handles at once. 
+*/
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectileManagerAsyncPullTest, "ProjectileManager.Pool.AsyncPullAgainstReturns", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectileManagerAsyncPullTest::RunTest(const FString& Parameters)
+{
+	const int32 PoolSize = 128;
+	const int32 NumWorkers = 4;
+	const int32 PullsPerWorker = 5000;
+	const int32 MaxHeld = PoolSize / 2;
+	const double TimeoutSeconds = 30.0;
+
+	FProjectileManagerTransientWorld World(TEXT("ProjectileManagerAsyncPullTest"));
+	if (!TestTrue(TEXT("The transient world was created"), World.IsValid())) return false;
+
+	AProjectileManagerBase* Manager = World.SpawnManager([PoolSize](AProjectileManagerBase* InManager)
+	{
+		InManager->InitSettings.ProjectileClassToUse = AManagedProjectileBase::StaticClass();
+		InManager->InitSettings.StartingPoolSize = PoolSize;
+		InManager->InitSettings.CreationBudgetMilliseconds = 0.f;
+		InManager->AutoscaleSettings.bEnableAutoscaling = false;
+		InManager->AutoscaleSettings.bGrowOnExhaustion = false;
+		InManager->GlobalSettings.bAllowAsyncPullFromPool = true;
+		InManager->GlobalSettings.AsyncTaskWaitTime = 0.f;
+	});
+	if (!TestNotNull(TEXT("The manager was spawned"), Manager)) return false;
+
+	const FProjectilePoolRequest PullRequest(true, false, ECollisionEnabled::QueryOnly, 0.f, FVector::ZeroVector, FVector::ForwardVector);
+	TQueue<FProjectileHandle, EQueueMode::Mpsc> ReservedHandles;
+	volatile int32 bStopWorkers = 0;
+
+	TArray<TFuture<void>> Workers;
+	for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; WorkerIndex++)
+	{
+		Workers.Add(Async(EAsyncExecution::TaskGraph, [Manager, &PullRequest, &ReservedHandles, &bStopWorkers, PullsPerWorker]()
+		{
+			for (int32 NumPulled = 0; NumPulled < PullsPerWorker && !FPlatformAtomics::AtomicRead(&bStopWorkers);)
+			{
+				FProjectileHandle Handle;
+				if (Manager->Request_GetProjectileAsync(0, PullRequest, Handle))
+				{
+					ReservedHandles.Enqueue(Handle);
+					NumPulled++;
+				}
+				else
+				{
+					FPlatformProcess::Yield();
+				}
+			}
+		}));
+	}
+
+	TArray<bool> HeldSlots;
+	HeldSlots.Init(false, PoolSize);
+	TArray<FProjectileHandle> Held;
+	TArray<FProjectileHandle> Reserved;
+	int32 NumApplied = 0;
+	bool bHeldTwice = false;
+	bool bNotAlive = false;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (;;)
+	{
+		// read the handles before the tick, their commands were queued before them so the tick applies every one. 
+		const bool bWorkersDone = Workers.FindByPredicate([](const TFuture<void>& Worker) { return !Worker.IsReady(); }) == nullptr;
+
+		Reserved.Reset();
+		for (FProjectileHandle Handle; ReservedHandles.Dequeue(Handle);) Reserved.Add(Handle);
+
+		Manager->Tick(0.f);
+
+		for (const FProjectileHandle& Handle : Reserved)
+		{
+			bNotAlive |= !Manager->IsProjectileHandleAlive(Handle);
+			bHeldTwice |= HeldSlots[Handle.GetSlotIndex()];
+			HeldSlots[Handle.GetSlotIndex()] = true;
+			Held.Add(Handle);
+			NumApplied++;
+		}
+
+		// return the oldest from the game thread while the workers keep reserving. 
+		while (Held.Num() > MaxHeld)
+		{
+			HeldSlots[Held[0].GetSlotIndex()] = false;
+			Manager->Request_ReturnProjectileHandleToManager(Held[0]);
+			Held.RemoveAt(0, 1, false);
+		}
+
+		if (bWorkersDone && Reserved.Num() <= 0 && ReservedHandles.IsEmpty()) break;
+
+		if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
+		{
+			AddError(TEXT("The async pulls did not finish in time"));
+			FPlatformAtomics::InterlockedExchange(&bStopWorkers, 1);
+			for (TFuture<void>& Worker : Workers) Worker.Wait();
+			break;
+		}
+	}
+
+	TestFalse(TEXT("Every applied async pull has a live handle"), bNotAlive);
+	TestFalse(TEXT("No slot was held by two handles at once"), bHeldTwice);
+	TestEqual(TEXT("Every async pull was applied"), NumApplied, NumWorkers * PullsPerWorker);
+
+	for (const FProjectileHandle& Handle : Held) Manager->Request_ReturnProjectileHandleToManager(Handle);
+	TestEqual(TEXT("Nothing is in use once everything was returned"), Manager->GetInUseCount(), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
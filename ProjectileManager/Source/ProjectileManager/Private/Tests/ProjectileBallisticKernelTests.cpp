@@ -0,0 +1,139 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Simulation/ProjectileBallisticKernel.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//-----------------------------------------------------------------------------------
+// Projectile Ballistic Kernel Test Helpers											-
+//-----------------------------------------------------------------------------------
+namespace ProjectileBallisticKernelTests
+{
+	/* The projectiles in every data set, not a multiple of four so the range ends in a tail */
+	static const int32 NumProjectiles = 37;
+
+	/* The first dense index the kernels run from, off the start so the range is unaligned too */
+	static const int32 StartIndex = 3;
+
+	/* Positions and velocities must match to this fraction of their size, or to this absolute amount below a size of 1 */
+	static const float IntegrateTolerance = 1.e-4f;
+
+	/* Orientations must be within this many radians of the reference */
+	static const float OrientationToleranceRadians = 1.e-3f;
+
+	/*	Fills a data set with the same random fan of projectiles for every seed. Some are fast 
+		enough to be clamped, one flies straight up so its yaw is undefined. 
+		@param: OutData: The data set to fill.
+		@param: InSeed: The seed of the fan.
+	*/
+	static void Fill_SimulationData(FProjectileSimulationData& OutData, int32 InSeed)
+	{
+		OutData.Initialize(NumProjectiles);
+		FRandomStream Stream(InSeed);
+
+		for (int32 i = 0; i < NumProjectiles; i++)
+		{
+			const FVector Direction = i == StartIndex + 2 ? FVector::UpVector : Stream.GetUnitVector();
+			FProjectileHandle Handle;
+			OutData.Add(FProjectilePoolRequest(true, false, ECollisionEnabled::QueryOnly, Stream.FRandRange(100.f, 12000.f), Stream.GetUnitVector() * 5000.f, Direction), 0.f, Handle);
+		}
+	}
+
+	/* Does a vectorized value match the scalar reference within the stated tolerance? */
+	static bool IsNearlyEqual(float InVectorized, float InScalar)
+	{
+		return FMath::Abs(InVectorized - InScalar) <= IntegrateTolerance * FMath::Max(1.f, FMath::Abs(InScalar));
+	}
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Ballistic Kernel Tests												-
+//-----------------------------------------------------------------------------------
+/*	Integrate_Vectorized has to match Integrate_Scalar for every projectile of the range, 
+	including the tail past the last full register, and leave the rest of the data alone. 
+*/
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectileBallisticKernelIntegrateTest, "ProjectileManager.Simulation.Kernel.IntegrateMatchesScalar", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectileBallisticKernelIntegrateTest::RunTest(const FString& Parameters)
+{
+	using namespace ProjectileBallisticKernelTests;
+
+	FProjectileSimulationData ScalarData, VectorizedData;
+	Fill_SimulationData(ScalarData, 7);
+	Fill_SimulationData(VectorizedData, 7);
+
+	// gravity, drag and a max speed some of the projectiles start above. 
+	const FProjectileBallisticParams Params(FVector(0.f, 0.f, -980.f), 0.25f, 8000.f);
+	const int32 Count = NumProjectiles - StartIndex;
+
+	for (int32 Step = 0; Step < 30; Step++)
+	{
+		FProjectileBallisticKernel::Integrate_Scalar(ScalarData, StartIndex, Count, 1.f / 60.f, Params);
+		FProjectileBallisticKernel::Integrate_Vectorized(VectorizedData, StartIndex, Count, 1.f / 60.f, Params);
+	}
+
+	for (int32 i = 0; i < NumProjectiles; i++)
+	{
+		const FVector ScalarPosition = ScalarData.GetPosition(i), VectorizedPosition = VectorizedData.GetPosition(i);
+		const FVector ScalarVelocity = ScalarData.GetVelocity(i), VectorizedVelocity = VectorizedData.GetVelocity(i);
+
+		bool bMatches = IsNearlyEqual(VectorizedData.Ages[i], ScalarData.Ages[i]);
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			bMatches &= IsNearlyEqual(VectorizedPosition[Axis], ScalarPosition[Axis]);
+			bMatches &= IsNearlyEqual(VectorizedVelocity[Axis], ScalarVelocity[Axis]);
+		}
+
+		TestTrue(FString::Printf(TEXT("Projectile %d matches the scalar path, vectorized %s %s, scalar %s %s"), i, *VectorizedPosition.ToString(), *VectorizedVelocity.ToString(), *ScalarPosition.ToString(), *ScalarVelocity.ToString()), bMatches);
+	}
+
+	// the projectiles before the range were never touched. 
+	for (int32 i = 0; i < StartIndex; i++)
+	{
+		TestEqual(FString::Printf(TEXT("Projectile %d before the range is untouched"), i), VectorizedData.Ages[i], 0.f);
+	}
+
+	return true;
+}
+
+/*	ComputeOrientations_Vectorized has to face every projectile of the range along its velocity 
+	the way FVector::ToOrientationQuat does, including the tail and a projectile flying straight up. 
+*/
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectileBallisticKernelOrientationTest, "ProjectileManager.Simulation.Kernel.OrientationsMatchReference", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectileBallisticKernelOrientationTest::RunTest(const FString& Parameters)
+{
+	using namespace ProjectileBallisticKernelTests;
+
+	FProjectileSimulationData Data;
+	Fill_SimulationData(Data, 11);
+
+	FProjectileBallisticKernel::ComputeOrientations_Vectorized(Data, StartIndex, NumProjectiles - StartIndex);
+
+	for (int32 i = StartIndex; i < NumProjectiles; i++)
+	{
+		const FQuat Reference = Data.GetVelocity(i).ToOrientationQuat();
+		const float Distance = Data.Orientations[i].AngularDistance(Reference);
+
+		TestTrue(FString::Printf(TEXT("Projectile %d is within %f radians of the reference, it is %f off"), i, OrientationToleranceRadians, Distance), Distance <= OrientationToleranceRadians);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,70 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Benchmark/ProjectileManagerBenchmark.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Benchmark Test Helpers										-
+//-----------------------------------------------------------------------------------
+namespace ProjectileManagerBenchmarkTests
+{
+	/*	Runs one case of the benchmark suite with the default settings and writes its json. 
+		@param: InTest: The test running the case, told where the json went.
+		@param: InCaseName: The name of the case.
+		@returns: if the case ran.
+	*/
+	static bool RunBenchmarkCase(FAutomationTestBase& InTest, const TCHAR* InCaseName)
+	{
+		FString SavedPath;
+		if (!FProjectileManagerBenchmark::RunCaseAndSave(InCaseName, FProjectileManagerBenchmarkSettings(), SavedPath))
+		{
+			InTest.AddError(FString::Printf(TEXT("The projectile manager benchmark case %s did not run"), InCaseName));
+			return false;
+		}
+
+		InTest.AddInfo(FString::Printf(TEXT("The projectile manager benchmark case %s was written to %s"), InCaseName, *SavedPath));
+		return true;
+	}
+}
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Benchmark Tests												-
+//-----------------------------------------------------------------------------------
+/* One test per benchmark case, the cases come from the suite so a new case is picked up without a test of its own */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FProjectileManagerBenchmarkTest, "ProjectileManager.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+void FProjectileManagerBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	TArray<FString> CaseNames;
+	FProjectileManagerBenchmark::GetCaseNames(CaseNames);
+
+	for (const FString& CaseName : CaseNames)
+	{
+		OutBeautifiedNames.Add(CaseName);
+		OutTestCommands.Add(CaseName);
+	}
+}
+
+bool FProjectileManagerBenchmarkTest::RunTest(const FString& Parameters)
+{
+	return ProjectileManagerBenchmarkTests::RunBenchmarkCase(*this, *Parameters);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
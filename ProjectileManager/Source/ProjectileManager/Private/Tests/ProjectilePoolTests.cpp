@@ -0,0 +1,294 @@
+/*	Copyright / License  Disclaimer
+ *	MIT Copyright 2020 Nicholas Mallonee
+ *	Permission is hereby granted, free of charge, to any person obtaining a 
+ *	copy of this software and associated documentation files(the "Software"), to deal 
+ *	in the Software without restriction, including without limitation the rights to use, 
+ *	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the 
+ *	Software, and to permit persons to whom the Software is furnished to do so, subject 
+ *	to the following conditions :
+ *	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. 
+ *	
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+ *	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+ *	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ *	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT 
+ *	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR 
+ *	OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ProjectileManager/Public/Pool/ProjectilePool.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//-----------------------------------------------------------------------------------
+// Projectile Pool Test Helpers														-
+//-----------------------------------------------------------------------------------
+namespace ProjectilePoolTests
+{
+	/* An eight bit generation, so a test can wrap it */
+	struct FNarrowGenerationPolicy : public FProjectilePoolDefaultPolicy
+	{
+		typedef uint8 GenerationType;
+	};
+
+	/*	Frees slots 2, 0 and 1 of a full pool of four in that order, then acquires three and 
+		records the slots they were handed. 
+		@param: Test: The test to report to.
+		@param: OutOrder: The slots handed out after the frees.
+		@returns: if the pool behaved.
+	*/
+	template<typename TPolicy>
+	static bool Run_ReuseOrder(FAutomationTestBase& Test, TArray<int32>& OutOrder)
+	{
+		TProjectilePool<int32, TPolicy> Pool(4);
+
+		TArray<typename TProjectilePool<int32, TPolicy>::FHandle> Handles;
+		for (int32 i = 0; i < 4; i++) Handles.Add(Pool.Acquire(i));
+
+		for (int32 i = 0; i < 4; i++)
+		{
+			if (!Test.TestEqual(TEXT("A fresh pool hands its slots out lowest first"), Handles[i].Index, i)) return false;
+		}
+
+		Pool.Release(Handles[2]);
+		Pool.Release(Handles[0]);
+		Pool.Release(Handles[1]);
+
+		for (int32 i = 0; i < 3; i++) OutOrder.Add(Pool.Acquire(10 + i).Index);
+		return true;
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Pool Tests															-
+//-----------------------------------------------------------------------------------
+/* Handles resolve while their use is live, and go stale on release however many times they are released. */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectilePoolHandleTest, "ProjectileManager.Pool.Template.Handles", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectilePoolHandleTest::RunTest(const FString& Parameters)
+{
+	TProjectilePool<int32> Pool(2);
+
+	const TProjectilePool<int32>::FHandle First = Pool.Acquire(7);
+	TestTrue(TEXT("An acquired handle is set"), First.IsSet());
+	TestTrue(TEXT("An acquired handle is alive"), Pool.IsAlive(First));
+	TestTrue(TEXT("An acquired handle resolves to its item"), Pool.Resolve(First) && *Pool.Resolve(First) == 7);
+	TestEqual(TEXT("One slot is live"), Pool.Num(), 1);
+
+	TestTrue(TEXT("The first release frees the slot"), Pool.Release(First));
+	TestFalse(TEXT("A released handle is stale"), Pool.IsAlive(First));
+	TestNull(TEXT("A released handle resolves to nothing"), Pool.Resolve(First));
+	TestFalse(TEXT("A second release is dropped"), Pool.Release(First));
+
+	const TProjectilePool<int32>::FHandle Second = Pool.Acquire(8);
+	TestEqual(TEXT("The freed slot is reused"), Second.Index, First.Index);
+	TestTrue(TEXT("The reuse is issued a new generation"), Second.Generation != First.Generation);
+	TestFalse(TEXT("The old handle does not resolve to the new use"), Pool.IsAlive(First));
+	TestFalse(TEXT("A release through the old handle is dropped"), Pool.Release(First));
+	TestTrue(TEXT("The new handle is still alive"), Pool.IsAlive(Second));
+	TestFalse(TEXT("An unset handle is never alive"), Pool.IsAlive(TProjectilePool<int32>::FHandle()));
+	return true;
+}
+
+/* Each free slot strategy hands freed slots back in its own order. */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectilePoolFreeSlotOrderTest, "ProjectileManager.Pool.Template.FreeSlotOrder", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectilePoolFreeSlotOrderTest::RunTest(const FString& Parameters)
+{
+	// slots 2, 0 and 1 are freed in that order. 
+	TArray<int32> Order;
+	if (!ProjectilePoolTests::Run_ReuseOrder<FProjectilePoolDefaultPolicy>(*this, Order)) return false;
+	TestTrue(TEXT("The stack hands out the slot freed last first"), Order == TArray<int32>({ 1, 0, 2 }));
+
+	Order.Reset();
+	if (!ProjectilePoolTests::Run_ReuseOrder<FProjectilePoolFifoPolicy>(*this, Order)) return false;
+	TestTrue(TEXT("The fifo hands out the slot freed first first"), Order == TArray<int32>({ 2, 0, 1 }));
+
+	Order.Reset();
+	if (!ProjectilePoolTests::Run_ReuseOrder<FProjectilePoolBitsetPolicy>(*this, Order)) return false;
+	TestTrue(TEXT("The bitset hands out the lowest slot first"), Order == TArray<int32>({ 0, 1, 2 }));
+
+	Order.Reset();
+	if (!ProjectilePoolTests::Run_ReuseOrder<FProjectilePoolLockFreePolicy>(*this, Order)) return false;
+	TestTrue(TEXT("The lock free stack hands out the slot freed last first"), Order == TArray<int32>({ 1, 0, 2 }));
+	return true;
+}
+
+/* A growing policy doubles a full pool, a fixed one fails the acquire and keeps its size. */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectilePoolGrowthTest, "ProjectileManager.Pool.Template.Growth", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectilePoolGrowthTest::RunTest(const FString& Parameters)
+{
+	TProjectilePool<int32> Growing(16);
+	for (int32 i = 0; i < 16; i++) Growing.Acquire(i);
+
+	const TProjectilePool<int32>::FHandle Grown = Growing.Acquire(16);
+	TestTrue(TEXT("An acquire on a full growing pool succeeds"), Grown.IsSet());
+	TestEqual(TEXT("The growing pool doubled"), Growing.GetCapacity(), 32);
+	TestEqual(TEXT("Every acquire is live"), Growing.Num(), 17);
+
+	TProjectilePool<int32, FProjectilePoolFixedPolicy> Fixed(4);
+	for (int32 i = 0; i < 4; i++) Fixed.Acquire(i);
+
+	TestFalse(TEXT("An acquire on a full fixed pool fails"), Fixed.Acquire(4).IsSet());
+	TestEqual(TEXT("The fixed pool kept its size"), Fixed.GetCapacity(), 4);
+	return true;
+}
+
+/*	A narrow generation wraps past its width without ever issuing 0. A released handle is stale 
+	until its generation comes round again, 255 uses later for eight bits, which is the limit 
+	the width sets on how long a stale handle is caught. 
+*/
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectilePoolGenerationWrapTest, "ProjectileManager.Pool.Template.GenerationWrap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectilePoolGenerationWrapTest::RunTest(const FString& Parameters)
+{
+	typedef TProjectilePool<int32, ProjectilePoolTests::FNarrowGenerationPolicy> FNarrowPool;
+	FNarrowPool Pool(1);
+
+	const FNarrowPool::FHandle First = Pool.Acquire(0);
+	Pool.Release(First);
+	TestFalse(TEXT("A released handle is stale"), Pool.IsAlive(First));
+
+	bool bIssuedZero = false;
+	int32 FirstReissue = INDEX_NONE;
+	for (int32 i = 1; i <= 300; i++)
+	{
+		const FNarrowPool::FHandle Handle = Pool.Acquire(i);
+		bIssuedZero |= Handle.Generation == 0;
+		if (Handle.Generation == First.Generation && FirstReissue == INDEX_NONE) FirstReissue = i;
+		Pool.Release(Handle);
+	}
+
+	TestFalse(TEXT("Generation 0 is never issued"), bIssuedZero);
+	TestEqual(TEXT("The first generation comes round again after every other one was issued"), FirstReissue, 255);
+
+	const FNarrowPool::FHandle Last = Pool.Acquire(1);
+	TestTrue(TEXT("The slot is still handed out after the wrap"), Pool.IsAlive(Last));
+	TestEqual(TEXT("The same slot is reused"), Last.Index, First.Index);
+	return true;
+}
+
+/*	A reserved slot is neither free nor alive until it is committed, and a reservation whose slot 
+	was emptied in the meantime can not be committed. 
+*/
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectilePoolReservationTest, "ProjectileManager.Pool.Template.Reservations", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectilePoolReservationTest::RunTest(const FString& Parameters)
+{
+	TProjectilePool<int32, FProjectilePoolLockFreePolicy> Pool(2);
+
+	const TProjectilePool<int32, FProjectilePoolLockFreePolicy>::FHandle Reserved = Pool.ReserveSlot();
+	TestTrue(TEXT("A slot was reserved"), Reserved.IsSet());
+	TestTrue(TEXT("The handle is the reservation of its slot"), Pool.IsReservedFor(Reserved));
+	TestFalse(TEXT("A reserved slot is not alive"), Pool.IsAlive(Reserved));
+	TestEqual(TEXT("A reserved slot is off the free list"), Pool.NumFree(), 1);
+	TestEqual(TEXT("A reserved slot is not live"), Pool.Num(), 0);
+
+	TestTrue(TEXT("The reservation commits"), Pool.CommitReservation(Reserved, 3));
+	TestTrue(TEXT("A committed slot is alive under its reservation handle"), Pool.IsAlive(Reserved));
+	TestFalse(TEXT("A committed reservation can not be committed again"), Pool.CommitReservation(Reserved, 4));
+
+	const TProjectilePool<int32, FProjectilePoolLockFreePolicy>::FHandle Lost = Pool.ReserveSlot();
+	Pool.EmptySlot(Lost.Index);
+	TestFalse(TEXT("An emptied reservation no longer holds"), Pool.IsReservedFor(Lost));
+	TestFalse(TEXT("An emptied reservation can not be committed"), Pool.CommitReservation(Lost, 5));
+	TestFalse(TEXT("An emptied slot can not be committed by index"), Pool.CommitSlot(Lost.Index).IsSet());
+	TestFalse(TEXT("Nothing is left to reserve"), Pool.ReserveSlot().IsSet());
+	return true;
+}
+
+/*	Empty slots are skipped by the free list rebuild, refilled in place, and trimmed off the back. 
+	With pool wide generations a slot trimmed and added again never repeats an old handle. 
+*/
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectilePoolEmptySlotsTest, "ProjectileManager.Pool.Template.EmptySlots", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectilePoolEmptySlotsTest::RunTest(const FString& Parameters)
+{
+	typedef TProjectilePool<FProjectilePoolNoItem, FProjectilePoolLockFreePolicy> FSlotPool;
+	FSlotPool Pool;
+	for (int32 i = 0; i < 4; i++) TestEqual(TEXT("Slots are added at the back"), Pool.AddFreeSlot(), i);
+
+	const FSlotPool::FHandle Live = Pool.CommitSlot(Pool.ReserveSlot().Index);
+	TestEqual(TEXT("The slot added last is handed out first"), Live.Index, 3);
+
+	// empty the free slots 1 and 2 the way a shrink does, off the free list first. 
+	Pool.ClearFreeSlots();
+	Pool.EmptySlot(1);
+	Pool.EmptySlot(2);
+	Pool.RebuildFreeSlots();
+
+	TestEqual(TEXT("Two slots are empty"), Pool.GetNumEmpty(), 2);
+	TestEqual(TEXT("Only the free slot is back on the free list"), Pool.NumFree(), 1);
+	TestEqual(TEXT("The trim stops at the slot in use at the back"), Pool.TrimTrailingEmptySlots(), 0);
+
+	TestTrue(TEXT("An empty slot can be filled"), Pool.FillEmptySlot(1));
+	TestFalse(TEXT("A filled slot can not be filled again"), Pool.FillEmptySlot(1));
+	TestEqual(TEXT("The filled slot is on the free list"), Pool.NumFree(), 2);
+
+	// the live slot at the back goes stale when emptied, and the trim can drop it. 
+	Pool.EmptySlot(Live.Index);
+	TestFalse(TEXT("An emptied live slot is stale"), Pool.IsAlive(Live));
+	TestEqual(TEXT("An emptied live slot is no longer live"), Pool.Num(), 0);
+	TestEqual(TEXT("The trim drops the empty slots at the back"), Pool.TrimTrailingEmptySlots(), 2);
+	TestEqual(TEXT("The slots in front of them are kept"), Pool.GetCapacity(), 2);
+	TestTrue(TEXT("The filled slot is still free"), Pool.GetStateAt(1) == EProjectilePoolSlotState::Free);
+
+	// every handle issued after is new, even on a slot trimmed and added again. 
+	TSet<int32> Issued;
+	Issued.Add(Live.Generation);
+	for (int32 Round = 0; Round < 8; Round++)
+	{
+		const int32 Index = Pool.AddFreeSlot();
+		const FSlotPool::FHandle Handle = Pool.CommitSlot(Pool.ReserveSlot().Index);
+		TestFalse(TEXT("A generation is never issued twice"), Issued.Contains(Handle.Generation));
+		Issued.Add(Handle.Generation);
+
+		Pool.EmptySlot(Handle.Index);
+		if (Handle.Index == Index) Pool.TrimTrailingEmptySlots();
+	}
+
+	return true;
+}
+
+/*	Reserves every slot of a lock free pool from several task graph threads at once. Each slot has 
+	to be reserved by exactly one thread, and every reservation commits on the owning thread after. 
+*/
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectilePoolConcurrentReserveTest, "ProjectileManager.Pool.Template.ConcurrentReserve", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FProjectilePoolConcurrentReserveTest::RunTest(const FString& Parameters)
+{
+	typedef TProjectilePool<FProjectilePoolNoItem, FProjectilePoolLockFreePolicy> FSlotPool;
+
+	const int32 NumSlots = 4096;
+	const int32 NumTasks = 8;
+
+	FSlotPool Pool(NumSlots);
+	TArray<TArray<FSlotPool::FHandle>> Reserved;
+	Reserved.SetNum(NumTasks);
+
+	ParallelFor(NumTasks, [&Pool, &Reserved](int32 TaskIndex)
+	{
+		for (FSlotPool::FHandle Handle = Pool.ReserveSlot(); Handle.IsSet(); Handle = Pool.ReserveSlot()) Reserved[TaskIndex].Add(Handle);
+	});
+
+	TArray<int32> Owners;
+	Owners.Init(0, NumSlots);
+	int32 NumReserved = 0;
+
+	for (const TArray<FSlotPool::FHandle>& TaskReserved : Reserved)
+	{
+		for (const FSlotPool::FHandle& Handle : TaskReserved)
+		{
+			if (!TestTrue(TEXT("A reserved slot is in range"), Owners.IsValidIndex(Handle.Index))) return false;
+
+			Owners[Handle.Index]++;
+			NumReserved++;
+			TestTrue(TEXT("Every reservation commits"), Pool.CommitReservation(Handle));
+		}
+	}
+
+	TestEqual(TEXT("Every slot was reserved"), NumReserved, NumSlots);
+	TestEqual(TEXT("No slot was reserved twice"), Owners.FilterByPredicate([](int32 Count) { return Count != 1; }).Num(), 0);
+	TestEqual(TEXT("Every slot is live"), Pool.Num(), NumSlots);
+	TestEqual(TEXT("The free list is empty"), Pool.NumFree(), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,105 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+class AProjectileManagerBase;
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Benchmark Structs												-
+//-----------------------------------------------------------------------------------
+/* Struct that defines one benchmark run, every pool size is measured at every occupancy by the cases that use them. */
+struct PROJECTILEMANAGER_API FProjectileManagerBenchmarkSettings
+{
+	// -- Public Information -- Properties -- //
+public:
+	TArray<int32> PoolSizes = { 1000, 10000, 100000 };
+	TArray<float> Occupancies = { 0.f, 0.5f, 0.9f, 0.99f };					/* Fractions of the pool held in use while measuring */
+	int32 Iterations = 10000;												/* Calls timed per measurement */
+	TArray<FString> Cases;													/* The cases to run by name, empty runs every case */
+	FString OutputPath;														/* Where the json is written, empty uses Saved/Benchmarks */
+
+public:
+	FProjectileManagerBenchmarkSettings()
+	{}
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Transient World												-
+//-----------------------------------------------------------------------------------
+/*	A game world of its own for the benchmark cases and the automation tests, begun so managers 
+	spawn their pools as they are spawned. The managers it spawned are destroyed, and the world 
+	torn down, when it goes out of scope. 
+*/
+struct PROJECTILEMANAGER_API FProjectileManagerTransientWorld
+{
+	// -- Public Information -- Methods -- //
+public:
+	explicit FProjectileManagerTransientWorld(const TCHAR* InName);
+	~FProjectileManagerTransientWorld();
+
+	FProjectileManagerTransientWorld(const FProjectileManagerTransientWorld&) = delete;
+	FProjectileManagerTransientWorld& operator=(const FProjectileManagerTransientWorld&) = delete;
+
+	/* Was the world created? */
+	bool IsValid() const { return World != nullptr; }
+
+	/* Gets the world */
+	UWorld* GetWorld() const { return World; }
+
+	/* Spawns a manager, configured before its begin play creates the pool, null if it could not be spawned */
+	AProjectileManagerBase* SpawnManager(TFunctionRef<void(AProjectileManagerBase*)> InConfigure);
+
+	/* Ticks the whole world once, returns the milliseconds the tick took */
+	double Tick(float DeltaTime);
+
+	// -- Private Information -- Properties -- //
+private:
+	UWorld* World = nullptr;
+	TArray<TWeakObjectPtr<AProjectileManagerBase>> SpawnedManagers;
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Benchmark														-
+//-----------------------------------------------------------------------------------
+/*	Benchmarks of the pool and the manager, run in transient game worlds so they work headless 
+	with -nullrhi -unattended. The suite is a list of named cases, each run on its own or all 
+	together, and each one is also registered as a "ProjectileManager.Benchmark.<Case>" automation 
+	test. The console command is a front end to the same cases with 
+	"ProjectileManager.Benchmark Cases=PoolOperations PoolSizes=1000,10000 Occupancies=0,0.99 Iterations=10000 Output=Path". 
+*/
+struct PROJECTILEMANAGER_API FProjectileManagerBenchmark
+{
+	/* Gets the name of every case, in the order the suite runs them */
+	static void GetCaseNames(TArray<FString>& OutCaseNames);
+
+	/* Runs the cases the settings ask for, the results are json so versions of the plugin can be compared */
+	static bool Run(const FProjectileManagerBenchmarkSettings& InSettings, FString& OutJson);
+
+	/* Runs the cases and writes the json to the output path */
+	static bool RunAndSave(const FProjectileManagerBenchmarkSettings& InSettings, FString& OutSavedPath);
+
+	/* Runs one case by name and writes its json, an unknown name fails */
+	static bool RunCaseAndSave(const FString& InCaseName, FProjectileManagerBenchmarkSettings InSettings, FString& OutSavedPath);
+};
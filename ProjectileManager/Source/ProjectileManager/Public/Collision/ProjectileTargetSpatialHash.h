@@ -0,0 +1,206 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProjectileManager/Public/Projectile/ManagedProjectileBase.h"
+#include "ProjectileTargetSpatialHash.generated.h"
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Target Enums and Delegates											-
+//-----------------------------------------------------------------------------------
+/* The shape a registered target is tested as */
+UENUM(BlueprintType)
+enum class EProjectileTargetShape : uint8
+{
+	Box		UMETA(DisplayName = "Box"),
+	Sphere	UMETA(DisplayName = "Sphere"),
+};
+
+/* Called on the game thread when a managed projectile touches a registered target */
+DECLARE_DELEGATE_ThreeParams(FOnProjectileTargetTouched, const FProjectileHandle& /* ProjectileHandle */, int32 /* TargetId */, const FVector& /* ProjectileLocation */);
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Target Structs														-
+//-----------------------------------------------------------------------------------
+/* The Struct that describes a target registered with the manager */
+USTRUCT(BlueprintType)
+struct FProjectileTargetDescription
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Target")
+	EProjectileTargetShape Shape = EProjectileTargetShape::Box;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Target")
+	FVector Center = FVector::ZeroVector;									/* Ignored while following an actor */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Target")
+	FVector BoxExtent = FVector(50.f, 50.f, 50.f);							/* Half size of the axis aligned box */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Target")
+	float SphereRadius = 50.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Target")
+	AActor* FollowActor = nullptr;											/* The bounds are centred on this actor every frame, if set */
+
+public:
+	/* Return the shape of the target */
+	EProjectileTargetShape GetShape() const { return Shape; }
+
+	/* Return the half size of the core box, a sphere is a point with a radius */
+	FVector GetCoreExtent() const { return Shape == EProjectileTargetShape::Box ? BoxExtent.GetAbs() : FVector::ZeroVector; }
+
+	/* Return the radius added around the core box */
+	float GetInflateRadius() const { return Shape == EProjectileTargetShape::Sphere ? FMath::Max(0.f, SphereRadius) : 0.f; }
+
+	/* Return the center of the target right now */
+	FVector GetCurrentCenter() const { return FollowActor ? FollowActor->GetActorLocation() : Center; }
+
+	/* Return the actor the target follows */
+	AActor* GetFollowActor() const { return FollowActor; }
+
+public:
+	FProjectileTargetDescription()
+	{}
+};
+
+
+/* A projectile touching a target, collected before any callback runs */
+struct FProjectileTargetTouch
+{
+	FProjectileHandle ProjectileHandle;
+
+	int32 TargetId = INDEX_NONE;
+
+	FVector ProjectileLocation = FVector::ZeroVector;
+
+	FProjectileTargetTouch()
+	{}
+
+	explicit FProjectileTargetTouch(const FProjectileHandle& InHandle, int32 InTargetId, const FVector& InLocation)
+	{
+		ProjectileHandle = InHandle;
+		TargetId = InTargetId;
+		ProjectileLocation = InLocation;
+	}
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Target Spatial Hash													-
+//-----------------------------------------------------------------------------------
+/*	The registered targets, bucketed into a uniform grid so a projectile only tests the 
+	targets around it. Every target is stored as a core box plus an inflate radius, a box 
+	target has no radius and a sphere target has no box, so one sphere against inflated box 
+	test covers both and can run four targets at a time. The buckets are rebuilt each frame 
+	with a counting sort, which is linear in the number of target cells and never allocates 
+	once warm. Targets covering too many cells skip the grid and are tested by every query. 
+*/
+struct PROJECTILEMANAGER_API FProjectileTargetSpatialHash
+{
+	// -- Public Information -- Registration -- //
+public:
+	/* Registers a target, returns the id used to move or remove it */
+	int32 AddTarget(const FProjectileTargetDescription& InDescription, const FOnProjectileTargetTouched& InCallback);
+
+	/* Removes a registered target */
+	bool RemoveTarget(int32 InTargetId);
+
+	/* Moves a target that does not follow an actor */
+	bool SetTargetCenter(int32 InTargetId, const FVector& InNewCenter);
+
+	/* Is the id a registered target? */
+	bool IsTargetRegistered(int32 InTargetId) const { return IdToDense.IsValidIndex(InTargetId) && IdToDense[InTargetId] != INDEX_NONE; }
+
+	/* Return the callback of a registered target */
+	const FOnProjectileTargetTouched* GetTargetCallback(int32 InTargetId) const;
+
+	/* Return the actor a registered target follows */
+	AActor* GetTargetActor(int32 InTargetId) const;
+
+	/* Return the number of registered targets */
+	int32 Num() const { return DenseToId.Num(); }
+
+	/* Removes every target and bucket */
+	void Reset();
+
+	// -- Public Information -- Queries -- //
+public:
+	/* Frees the removed ids, pulls the followed actor locations and rebuilds the buckets */
+	void Rebuild(float InCellSize);
+
+	/* Finds every target a sphere touches, appends the target ids */
+	void QueryTouchingTargets(const FVector& InCenter, float InRadius, TArray<int32>& OutTargetIds);
+
+	// -- Private Information -- Helpers -- //
+private:
+	/* Writes the bounds of a dense target from its center */
+	void SetDenseBounds(int32 InDenseIndex, const FVector& InCenter);
+
+	/* Gets the integer cell a world position falls in */
+	FIntVector GetCell(const FVector& InLocation) const;
+
+	/* Gets the bucket a cell hashes to */
+	int32 GetBucket(const FIntVector& InCell) const;
+
+	/* Collects the dense index once per query, using the query stamp */
+	void AddCandidate(int32 InDenseIndex);
+
+	/* Tests the collected candidates, four at a time */
+	void TestCandidates(const FVector& InCenter, float InRadius, TArray<int32>& OutTargetIds) const;
+
+	// -- Private Information -- Dense Target Properties -- //
+private:
+	TArray<float> CoreMinX;
+	TArray<float> CoreMinY;
+	TArray<float> CoreMinZ;
+	TArray<float> CoreMaxX;
+	TArray<float> CoreMaxY;
+	TArray<float> CoreMaxZ;
+	TArray<float> InflateRadii;
+	TArray<FVector> CoreExtents;
+	TArray<TWeakObjectPtr<AActor>> FollowActors;
+	TArray<FOnProjectileTargetTouched> Callbacks;
+	TArray<int32> DenseToId;
+
+	// -- Private Information -- Sparse Target Properties -- //
+private:
+	TArray<int32> IdToDense;
+	TArray<int32> FreeIds;
+	TArray<int32> RemovedIds;													/* Held until the next rebuild, so touches found for an id never reach a new target */
+
+	// -- Private Information -- Buckets -- //
+private:
+	float InvCellSize = 1.f / 500.f;
+	int32 BucketMask = 0;
+	TArray<int32> BucketStarts;													/* Bucket b holds BucketEntries[BucketStarts[b], BucketStarts[b + 1]) */
+	TArray<int32> BucketEntries;
+	TArray<int32> BucketCursors;
+	TArray<int32> OversizedTargets;
+
+	// -- Private Information -- Query Scratch -- //
+private:
+	TArray<uint32> QueryStamps;
+	uint32 CurrentQueryStamp = 0;
+	TArray<int32> Candidates;
+};
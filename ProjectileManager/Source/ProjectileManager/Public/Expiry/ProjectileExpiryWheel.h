@@ -0,0 +1,117 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProjectileManager/Public/Projectile/ManagedProjectileBase.h"
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Expiry Structs														-
+//-----------------------------------------------------------------------------------
+/* A scheduled expiry, the lifetime deadline and the travel limit of one projectile use */
+struct FProjectileExpiry
+{
+	FProjectileHandle ProjectileHandle;
+	FVector Origin = FVector::ZeroVector;									/* Where the projectile was fired from */
+	float MaxTravelDistance = 0.f;											/* 0 has no travel limit */
+	int64 LifetimeTick = MAX_int64;											/* The wheel tick the lifetime runs out on, MAX_int64 has no lifetime */
+
+	/* Does the projectile have a travel limit? */
+	bool HasTravelLimit() const { return MaxTravelDistance > 0.f; }
+
+	/* Has the lifetime run out by this tick? */
+	bool IsLifetimeOver(int64 InCurrentTick) const { return InCurrentTick >= LifetimeTick; }
+
+	FProjectileExpiry()
+	{}
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Expiry Wheel															-
+//-----------------------------------------------------------------------------------
+/*	A hierarchical timing wheel. Time is cut into fixed ticks, level 0 has a slot per tick for 
+	the next 64 ticks, and every level above has a slot per 64 slots of the level below. An 
+	expiry goes into the lowest level that can hold it, and is moved down a level when its slot 
+	comes up, so an insert and an expiry are both constant time whatever the delay. Nothing is 
+	removed early, an expiry for a projectile returned since just fails to resolve its handle. 
+	The expiries live in one node array with a free list, so the wheel never allocates once warm. 
+*/
+struct PROJECTILEMANAGER_API FProjectileExpiryWheel
+{
+	// -- Public Information -- Scheduling -- //
+public:
+	/* Empties the wheel and sets the tick length */
+	void Reset(float InResolutionSeconds);
+
+	/* Schedules an expiry to come due after a delay, never later than its lifetime tick */
+	void Schedule(const FProjectileExpiry& InExpiry, float InDelaySeconds);
+
+	/* Moves time forward, appends every expiry that came due */
+	int32 Advance(float DeltaTime, TArray<FProjectileExpiry>& OutDueExpiries);
+
+	/* Gets the wheel tick a delay from now falls on */
+	int64 GetTickAfter(float InDelaySeconds) const;
+
+	/* Gets the current wheel tick */
+	int64 GetCurrentTick() const { return CurrentTick; }
+
+	/* Gets the number of scheduled expiries */
+	int32 Num() const { return NumScheduled; }
+
+	// -- Private Information -- Helpers -- //
+private:
+	/* Links a node into the slot its due tick falls in */
+	void Insert(int32 InNodeIndex);
+
+	/* Moves every node in a slot down to the levels below */
+	void Cascade(int32 InLevel, int32 InSlot);
+
+	/* Gets the index of a slot in the slot heads */
+	static int32 GetSlotHead(int32 InLevel, int32 InSlot) { return InLevel * SlotsPerLevel + InSlot; }
+
+	// -- Private Information -- Properties -- //
+private:
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+	static constexpr int32 NumLevels = 4;
+
+	struct FNode
+	{
+		FProjectileExpiry Expiry;
+		int64 DueTick = 0;
+		int32 Next = INDEX_NONE;
+	};
+
+	TArray<FNode> Nodes;
+	int32 FreeNodeHead = INDEX_NONE;
+	int32 SlotHeads[NumLevels * SlotsPerLevel];
+
+	int64 CurrentTick = 0;
+	float ResolutionSeconds = 0.05f;
+	float AccumulatedTime = 0.f;
+	int32 NumScheduled = 0;
+
+public:
+	FProjectileExpiryWheel()
+	{
+		Reset(ResolutionSeconds);
+	}
+};
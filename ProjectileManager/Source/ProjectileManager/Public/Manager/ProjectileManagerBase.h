@@ -1,316 +1,1358 @@
-/*	Copyright / License  Disclaimer
-*	MIT Copyright 2020 Nicholas Mallonee
-*	Permission is hereby granted, free of charge, to any person obtaining a
-*	copy of this software and associated documentation files(the "Software"), to deal
-*	in the Software without restriction, including without limitation the rights to use,
-*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
-*	Software, and to permit persons to whom the Software is furnished to do so, subject
-*	to the following conditions :
-*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
-*
-*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
-*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
-*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
-*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
-*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
-*	OTHER DEALINGS IN THE SOFTWARE.
-*/
-#pragma once
-
-#include "CoreMinimal.h"
-#include "Core.h"
-#include "GameFramework/Actor.h"
-#include "ProjectileManager/Public/Projectile/ManagedProjectileBase.h"
-#include "ProjectileManagerBase.generated.h"
-
-
-//-----------------------------------------------------------------------------------
-// Projectile Manager Base Class Structs											-
-//-----------------------------------------------------------------------------------
-/* The Struct that is used to maintain a record of each managed projectile */
-USTRUCT()
-struct FManagedProjectileEntry
-{
-	GENERATED_BODY()
-
-	// -- Public Information -- Properties -- //
-public:
-	UPROPERTY()
-	bool bIsCurrentlyInUse = false;											/* Is this entry currently in use? */
-
-	UPROPERTY()
-	AManagedProjectileBase* ManagedProjectilePtr = nullptr;					/* Pointer to object */
-
-public:
-	/* Gets if the current entry is in use. */
-	bool IsInUse() const { return bIsCurrentlyInUse; }
-
-	/* Is this entry valid? */
-	bool IsValid() const { return ManagedProjectilePtr != nullptr; }
-
-	/* Is the incoming pointer the same as ours? */
-	bool IsEntry(AManagedProjectileBase* InPtrToCheck) const { return GetManagedProjectilePtr() == InPtrToCheck; }
-
-	/* Gets a ptr to the managed reference*/
-	AManagedProjectileBase* GetManagedProjectilePtr() const { return ManagedProjectilePtr; }
-
-	/* Mark an entry in use. */
-	AManagedProjectileBase* MarkEntryInUse()
-	{
-		bIsCurrentlyInUse = true;
-		return GetManagedProjectilePtr();	
-	}
-
-	AManagedProjectileBase* MarkEntryInUse(int32& ConfirmedIndex)
-	{
-		bIsCurrentlyInUse = true;
-		if (ManagedProjectilePtr)ManagedProjectilePtr->UpdateLastKnownEntryInPool(ConfirmedIndex);
-		return GetManagedProjectilePtr();
-	}
-
-	/* Unmark an entry as it is no longer in use. */
-	void UnMarkEntryInUse()
-	{
-		bIsCurrentlyInUse = false;
-	}
-
-	/* Cleans Up the entry. */
-	void CleanUpEntry()
-	{
-		if (!IsValid()) return;
-		else
-		{
-			ManagedProjectilePtr->Deinit_ProjectileBase();
-			ManagedProjectilePtr = nullptr;
-		}
-	}
-
-public:
-	FManagedProjectileEntry()
-	{}
-
-	explicit struct FManagedProjectileEntry(AManagedProjectileBase* NewPointerToManage)
-	{
-		ManagedProjectilePtr = NewPointerToManage;
-	}
-};
-
-/* The Struct that defines the init properties of this manager  */
-USTRUCT(BlueprintType)
-struct FProjectileManagerInitSettings
-{
-	GENERATED_BODY()
-
-public:
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
-	bool bStartWithNoCollisionOnProjectile = true; 
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
-	int32 StartingPoolSize = 500;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
-	TSubclassOf<AManagedProjectileBase> ProjectileClassToUse;
-
-public:
-	/* Return if we start with collision */
-	bool GetStartWithCollision() const { return bStartWithNoCollisionOnProjectile; }
-
-	/* Return the starting pool size. */
-	int32 GetStartingPoolSize() const { return StartingPoolSize; }
-
-	/* Return the projectile class to spawn. */
-	UClass* GetProjectileClassToSpawn() const { return ProjectileClassToUse; }
-
-public:
-	FProjectileManagerInitSettings()
-	{}
-};
-
-/* The Struct that defines the retrieve and return settings of into and out of the pool  */
-USTRUCT(BlueprintType)
-struct FProjectileManagerRetrieveReturnSettings
-{
-	GENERATED_BODY()
-
-public:
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Retrieval Return Settings")
-	bool bStartAtFrontOfPool = true;
-
-	
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Retrieval Return Settings")
-	FProjectilePoolRequest ReturnProjectileRequest;
-
-public:
-	/* Return if we start with collision */
-	bool StartSearchAtBeginningOfPool() const { return bStartAtFrontOfPool; }
-
-public:
-	FProjectileManagerRetrieveReturnSettings()
-	{}
-};
-
-/* The Struct that defines the global setting  */
-USTRUCT(BlueprintType)
-struct FProjectileManagerGlobalSettings
-{
-	GENERATED_BODY()
-
-public:
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
-	bool bOptimizeWithNewRequestsUsingLastReturned = false;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
-	bool bAllowForProjectilesTickAsync = false;
-	
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
-	bool bAllowAsyncPullFromPool = false;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
-	bool bAllowAsyncReturnToPool = false;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
-	int32 LastReturnedCacheSize = 10;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
-	float AsyncTaskWaitTime = 0.0083f;	// default of 120fps
-
-	UPROPERTY()
-	TArray<int32> LastReturned;
-
-public:
-	/* return if we can trying optimizing using the last returned index */
-	bool AllowedToOptimizeWithRequestsUsingLastReturned() const { return bOptimizeWithNewRequestsUsingLastReturned; }
-
-	bool AllowForProjectilesToTickAsync() { return bAllowForProjectilesTickAsync; }
-
-	bool AllowAsyncPullFromPool() const { return bAllowAsyncPullFromPool; }
-
-	bool AllowAsyncReturnToPool() const { return bAllowAsyncReturnToPool; }
-
-	/* Returns the Last returned entry */
-	int32 GetLastReturnedEntry() { return LastReturned.Num() > 0 ? LastReturned.Pop(true) : -1; }
-
-	float GetAsyncWaitTime() const { return AsyncTaskWaitTime; }
-
-	/* Updates the last returned entry */
-	void AddLastReturned(int32& idx)
-	{
-		if (LastReturned.Num() >= LastReturnedCacheSize) return;
-		else
-			LastReturned.Push(idx);
-	}
-
-public:
-	FProjectileManagerGlobalSettings()
-	{}
-};
-
-
-//-----------------------------------------------------------------------------------
-// Projectile Manager Base Class Declariations										-
-//-----------------------------------------------------------------------------------
-UCLASS()
-class PROJECTILEMANAGER_API AProjectileManagerBase : public AActor
-{
-	GENERATED_BODY()
-	
-	// -- Public Information -- Projectile Manager Constructor and Engine Events -- //
-public:	
-	AProjectileManagerBase();
-
-	virtual void BeginPlay() override;
-
-	virtual void Tick(float DeltaTime) override;
-
-	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-
-	// -- Public Information -- Projectile Manager Methods -- //
-public:
-	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
-	virtual bool Request_ResizeProjectilePool(UPARAM(ref)int32& InNewProjectilePoolSize);
-
-	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
-	virtual bool Request_GetProjectileFromManager(AManagedProjectileBase*& OutProjectileToUse, UPARAM(ref) FProjectilePoolRequest& RetreieveSettings);
-
-	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
-	virtual bool Request_ReturnProjectileToManager(UPARAM(ref) AManagedProjectileBase*& InProjectileToReturn);
-
-	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
-	int32 GetCurrentPoolSize() const;
-
-	// -- Private Information -- Projectile Manager Internal Methods -- //
-private:
-	/* Creates a Projectile Pool, allocates space via the spawn */
-	virtual bool Create_ProjectilePool(int32 DesiredSize);
-
-	/* Resizes a projectile pool to a specific size, destroys or creates as needed */
-	virtual bool Resize_ProjectilePool(int32& InNewProjectilePoolSize);
-
-	/* Cleans Up the projectile pool, basically a destroy all */
-	virtual bool CleanUp_ProjectilePool();
-
-	/* Findes potential index to remove, false if none exist */
-	bool FindPotentialEntriesToRemove(TArray<int32>& OutPotentialIndexs, int32& InNumWantingToRemove);
-
-	/* Attempts to remove entries from the managed list */
-	bool AttemptToRemoveEntries(TArray<int32>& InPotentialIndexs, int32& InNumToRemove, int32& CurrentPoolTargetSize);
-
-	/* Doe have a valid last known entry ?*/
-	bool DoWeHaveValidLastKnownEntry(int32& OutEntry);
-
-	/* Finds the first object to return, -1 if none */
-	int32 FindFirstAvalibleIndex(bool bFromFront = false);
-
-	/* Find the object to return, -1 if not found */
-	int32 FindIndexFromPointer(bool bFromFront, AManagedProjectileBase*& InProjectileToReturn);
-
-	/* Updates Last Returned index */
-	void UpdateLastReturnedEntry(int32 InEntryKey);
-
-	// -- Private Information -- Settings Methods -- //
-private:
-	/* Does the actor start with collision enabled? */
-	bool InitProjectilesWithCollisionEnabled() const { return InitSettings.GetStartWithCollision(); }
-
-	/* Should we do any searchs from the front or the back of the managed pool? */
-	bool ShouldRetreieveFromTheFrontOfThePool() const { return RetrieveReturnSettings.StartSearchAtBeginningOfPool(); }	
-
-	/* Should we do any searchs from the front or the back of the managed pool? */
-	bool OptimizeRequestsWithCachingLastReturned() const { return GlobalSettings.AllowedToOptimizeWithRequestsUsingLastReturned(); }
-
-	bool OptimizeProjectilesMustTickAsync() { return GlobalSettings.AllowForProjectilesToTickAsync(); }
-
-	/* What is the init pool size? */
-	int32 GetInitProjectilePoolSize() const { return InitSettings.GetStartingPoolSize(); }
-
-	/* WHere does the pool store the projectiles in the world? */
-	FVector GetPoolLocation() const { return RetrieveReturnSettings.ReturnProjectileRequest.GetStartLocation(); }
-
-	/* Return the settings */
-	FProjectilePoolRequest GetReturnRequestSettings() const { return RetrieveReturnSettings.ReturnProjectileRequest; }
-
-	/* What class do we work with? */
-	UClass* GetProjectileClassToUse() const { return InitSettings.GetProjectileClassToSpawn(); }
-
-
-	// -- Public Information -- Projectile Manager Exposed Properties -- //
-public:
-	UPROPERTY()
-	bool bNeedToRemoveOnReturn = false;		// Used to check if we need to remove
-
-	UPROPERTY()
-	int32 CurrentPoolSizeTarget = 0;		// Used to determine the target size for passive. 
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Init ")
-	FProjectileManagerInitSettings InitSettings;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Retrieve / Return  ")
-	FProjectileManagerRetrieveReturnSettings RetrieveReturnSettings;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Global ")
-	FProjectileManagerGlobalSettings GlobalSettings;
-
-	UPROPERTY()
-	TArray<FManagedProjectileEntry> ManagedPool;
-};
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core.h"
+#include "GameFramework/Actor.h"
+#include "WorldCollision.h"
+#include "Containers/Queue.h"
+#include "Misc/ScopeRWLock.h"
+#include "Async/Future.h"
+#include "ProjectileManager/Public/Projectile/ManagedProjectileBase.h"
+#include "ProjectileManager/Public/Simulation/ProjectileSimulationData.h"
+#include "ProjectileManager/Public/Collision/ProjectileTargetSpatialHash.h"
+#include "ProjectileManager/Public/Expiry/ProjectileExpiryWheel.h"
+#include "ProjectileManager/Public/Pool/ProjectilePool.h"
+#include "ProjectileManager/Public/Pool/ProjectileFireCommandBuffer.h"
+#include "ProjectileManagerBase.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Base Class Enums												-
+//-----------------------------------------------------------------------------------
+/* How the projectiles find what they hit */
+UENUM(BlueprintType)
+enum class EProjectileCollisionMode : uint8
+{
+	ComponentOverlap	UMETA(DisplayName = "Component Overlap"),		/* Each projectile collides through its own sphere component */
+	AsyncSweep			UMETA(DisplayName = "Async Sweep"),				/* The manager sweeps every live projectile, consumed a frame later */
+};
+
+/* How the manager stores and moves its projectiles */
+UENUM(BlueprintType)
+enum class EProjectilePoolMode : uint8
+{
+	ActorPool			UMETA(DisplayName = "Actor Pool"),				/* Pooled AManagedProjectileBase actors */
+	DataSimulation		UMETA(DisplayName = "Data Simulation"),			/* Actorless projectiles simulated by the manager */
+};
+
+/* Who ticks the pooled projectile actors */
+UENUM(BlueprintType)
+enum class EProjectileTickMode : uint8
+{
+	PerActor			UMETA(DisplayName = "Per Actor"),				/* Each projectile and its movement component tick themselves */
+	ManagerBatched		UMETA(DisplayName = "Manager Batched"),			/* One manager tick moves every live projectile in pool order */
+};
+
+/* How the pooled projectile actors are drawn */
+UENUM(BlueprintType)
+enum class EProjectileRenderMode : uint8
+{
+	PerActor			UMETA(DisplayName = "Per Actor"),				/* Each projectile draws its own components */
+	InstancedMesh		UMETA(DisplayName = "Instanced Mesh"),			/* The manager draws every live projectile of a class as one instanced mesh */
+};
+
+/* How returned projectiles wait in the pool */
+UENUM(BlueprintType)
+enum class EProjectileParkingMode : uint8
+{
+	Teleport			UMETA(DisplayName = "Teleport"),				/* Moved to the pool location, the components stay registered */
+	Unregister			UMETA(DisplayName = "Unregister"),				/* The components are unregistered until the projectile is pulled again */
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Base Class Delegates											-
+//-----------------------------------------------------------------------------------
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSimulatedProjectileExpired, const FProjectileHandle&, ExpiredHandle, FVector, LastLocation);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnManagedProjectileHit, const FProjectileHandle&, ProjectileHandle, const FHitResult&, Hit);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnProjectilePoolCreationProgress, int32, ClassId, int32, NumCreated, int32, NumToCreate);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnProjectilePoolCreationComplete, int32, ClassId, int32, PoolSize);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnManagedProjectileExpired, const FProjectileHandle&, ExpiredHandle, FVector, LastLocation);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAsyncProjectileAcquired, const FProjectileHandle&, ProjectileHandle, AManagedProjectileBase*, Projectile);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnProjectileTargetHit, const FProjectileHandle&, ProjectileHandle, int32, TargetId, AActor*, TargetActor);
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Base Class Structs											-
+//-----------------------------------------------------------------------------------
+/* The slots of one sub pool, reserved from any thread, its generations come from one counter so a trimmed slot never repeats a handle */
+typedef TProjectilePool<FProjectilePoolNoItem, FProjectilePoolLockFreePolicy> FManagedProjectileSlotPool;
+
+/* The Struct that is used to maintain a record of each managed projectile, its slot state and generation live in the sub pools slot pool */
+USTRUCT()
+struct FManagedProjectileEntry
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Properties -- //
+public:
+	UPROPERTY()
+	AManagedProjectileBase* ManagedProjectilePtr = nullptr;					/* Pointer to object */
+
+	UPROPERTY()
+	bool bIsPendingReturn = false;											/* Is this entry queued for the end of frame return pass? */
+
+	UPROPERTY()
+	bool bSweepForHits = false;												/* Did the pull ask for collision, used when the manager sweeps for it */
+
+	UPROPERTY()
+	FVector LastSweptLocation = FVector::ZeroVector;						/* Where the last manager sweep ended */
+
+	UPROPERTY()
+	TWeakObjectPtr<AActor> SweepOwningActor = nullptr;						/* The actor that fired the projectile, the sweeps can ignore it */
+
+	UPROPERTY()
+	float FireTime = 0.f;													/* The world time the current use was pulled at */
+
+	UPROPERTY()
+	int32 SignificanceBucket = INDEX_NONE;									/* The significance bucket the projectile steps at, none is full rate */
+
+public:
+	/* Is this entry valid? */
+	bool IsValid() const { return ManagedProjectilePtr != nullptr; }
+
+	/* Is the incoming pointer the same as ours? */
+	bool IsEntry(AManagedProjectileBase* InPtrToCheck) const { return GetManagedProjectilePtr() == InPtrToCheck; }
+
+	/* Gets a ptr to the managed reference*/
+	AManagedProjectileBase* GetManagedProjectilePtr() const { return ManagedProjectilePtr; }
+
+	/* Mark an entry in use, once its slot is committed with the issued handle. */
+	AManagedProjectileBase* MarkEntryInUse(const FProjectileHandle& IssuedHandle)
+	{
+		bIsPendingReturn = false;
+		if (ManagedProjectilePtr)ManagedProjectilePtr->UpdatePoolHandle(IssuedHandle);
+		return GetManagedProjectilePtr();
+	}
+
+	/* Unmark an entry as it is no longer in use. */
+	void UnMarkEntryInUse()
+	{
+		bIsPendingReturn = false;
+		bSweepForHits = false;
+		SweepOwningActor = nullptr;
+	}
+
+	/* Is the entry already queued for the end of frame return pass? */
+	bool IsPendingReturn() const { return bIsPendingReturn; }
+
+	/* Mark or unmark the entry as queued for the end of frame return pass. */
+	void MarkPendingReturn(bool bNewState)
+	{
+		bIsPendingReturn = bNewState;
+	}
+
+	/* Should the manager sweep this entry for hits? Cleared on return, so only an in use entry asks. */
+	bool ShouldSweepForHits() const { return bSweepForHits; }
+
+	/* Records if the entry wants the manager to sweep it, and where the sweeps start from. */
+	void SetSweepState(bool bNewSweepForHits, const FVector& InSweepStart, AActor* InOwningActor)
+	{
+		bSweepForHits = bNewSweepForHits;
+		LastSweptLocation = InSweepStart;
+		SweepOwningActor = InOwningActor;
+	}
+
+	/* Cleans Up the entry. */
+	void CleanUpEntry()
+	{
+		if (!IsValid()) return;
+		else
+		{
+			ManagedProjectilePtr->Deinit_ProjectileBase();
+			ManagedProjectilePtr = nullptr;
+		}
+	}
+
+public:
+	FManagedProjectileEntry()
+	{}
+
+	explicit struct FManagedProjectileEntry(AManagedProjectileBase* NewPointerToManage)
+	{
+		ManagedProjectilePtr = NewPointerToManage;
+	}
+};
+
+/* The Struct that defines an extra projectile class pooled by the same manager */
+USTRUCT(BlueprintType)
+struct FProjectileSubPoolSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Sub Pool Settings")
+	TSubclassOf<AManagedProjectileBase> ProjectileClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Sub Pool Settings", meta = (ClampMin = "1"))
+	int32 StartingPoolSize = 100;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Sub Pool Settings")
+	UStaticMesh* InstanceMesh = nullptr;							/* Drawn for each live projectile of this class in the instanced mesh render mode */
+
+public:
+	/* Return the class pooled */
+	UClass* GetProjectileClass() const { return ProjectileClass; }
+
+	/* Return the starting pool size */
+	int32 GetStartingPoolSize() const { return StartingPoolSize; }
+
+	/* Return the mesh instanced for this class */
+	UStaticMesh* GetInstanceMesh() const { return InstanceMesh; }
+
+public:
+	FProjectileSubPoolSettings()
+	{}
+};
+
+/* The Struct that defines the init properties of this manager  */
+USTRUCT(BlueprintType)
+struct FProjectileManagerInitSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
+	bool bStartWithNoCollisionOnProjectile = true; 
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
+	int32 StartingPoolSize = 500;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
+	TSubclassOf<AManagedProjectileBase> ProjectileClassToUse;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
+	EProjectilePoolMode PoolMode = EProjectilePoolMode::ActorPool;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
+	EProjectileTickMode TickMode = EProjectileTickMode::PerActor;		/* Only used by the actor pool, batched projectiles never run their actor tick */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
+	EProjectileRenderMode RenderMode = EProjectileRenderMode::PerActor;	/* Only used by the actor pool */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
+	UStaticMesh* InstanceMesh = nullptr;							/* Drawn for each live projectile of the class to use in the instanced mesh render mode */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
+	TArray<FProjectileSubPoolSettings> AdditionalProjectileClasses;		/* Each gets its own sub pool, class id 1 onward, the class to use above is class id 0 */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings", meta = (ClampMin = "0.0"))
+	float CreationBudgetMilliseconds = 0.f;							/* Time spent spawning the pool per frame, 0 spawns it all at once */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Init Settings")
+	FName ManagerTag = NAME_None;									/* Finds this manager when several are in the world, None is only found untagged */
+
+public:
+	/* Return if we start with collision */
+	bool GetStartWithCollision() const { return bStartWithNoCollisionOnProjectile; }
+
+	/* Return the starting pool size. */
+	int32 GetStartingPoolSize() const { return StartingPoolSize; }
+
+	/* Return the projectile class to spawn. */
+	UClass* GetProjectileClassToSpawn() const { return ProjectileClassToUse; }
+
+	/* Return how the projectiles are stored. */
+	EProjectilePoolMode GetPoolMode() const { return PoolMode; }
+
+	/* Return who ticks the projectiles. */
+	EProjectileTickMode GetTickMode() const { return TickMode; }
+
+	/* Return how the projectiles are drawn. */
+	EProjectileRenderMode GetRenderMode() const { return RenderMode; }
+
+	/* Return the mesh instanced for the class to use. */
+	UStaticMesh* GetInstanceMesh() const { return InstanceMesh; }
+
+	/* Return the extra classes pooled, only used by the actor pool. */
+	const TArray<FProjectileSubPoolSettings>& GetAdditionalProjectileClasses() const { return AdditionalProjectileClasses; }
+
+	/* Return if the pool is created over several frames. */
+	bool IsCreationTimeSliced() const { return CreationBudgetMilliseconds > 0.f; }
+
+	/* Return the time spent spawning the pool per frame. */
+	double GetCreationBudgetSeconds() const { return FMath::Max(CreationBudgetMilliseconds, 0.f) / 1000.0; }
+
+	/* Return the tag the manager is found by. */
+	FName GetManagerTag() const { return ManagerTag; }
+
+public:
+	FProjectileManagerInitSettings()
+	{}
+};
+
+/* The Struct that defines the retrieve and return settings of into and out of the pool  */
+USTRUCT(BlueprintType)
+struct FProjectileManagerRetrieveReturnSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Retrieval Return Settings")
+	bool bDeferReturnsToEndOfFrame = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Retrieval Return Settings")
+	FProjectilePoolRequest ReturnProjectileRequest;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Retrieval Return Settings", meta = (ClampMin = "0.001"))
+	float ExpiryResolutionSeconds = 0.05f;							/* How finely lifetimes and travel limits are timed, expiries are never early */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Retrieval Return Settings")
+	EProjectileParkingMode ParkingMode = EProjectileParkingMode::Teleport;	/* Only used by the actor pool */
+
+public:
+	/* Are returns queued and handled in one pass at the end of the frame? */
+	bool DeferReturnsToEndOfFrame() const { return bDeferReturnsToEndOfFrame; }
+
+	/* Return the length of one expiry wheel tick. */
+	float GetExpiryResolutionSeconds() const { return FMath::Max(ExpiryResolutionSeconds, 0.001f); }
+
+	/* Return how returned projectiles wait in the pool. */
+	EProjectileParkingMode GetParkingMode() const { return ParkingMode; }
+
+public:
+	FProjectileManagerRetrieveReturnSettings()
+	{}
+};
+
+/* The Struct that defines how actorless projectiles are simulated in the data simulation mode */
+USTRUCT(BlueprintType)
+struct FProjectileManagerSimulationSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings")
+	float GravityScale = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings")
+	float CollisionRadius = 32.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings")
+	float LinearDrag = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings")
+	float MaxSpeed = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings")
+	bool bRotationFollowsVelocity = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings")
+	bool bUseVectorizedKernel = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings")
+	float MaxLifetime = 0.f;														// seconds before a projectile expires, 0 never expires. Scheduled on the expiry wheel, a shorter request lifetime wins. 
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings")
+	bool bSimulateInParallel = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings", meta = (ClampMin = "4"))
+	int32 ParallelChunkSize = 2048;													// projectiles per chunk, small enough for a chunk to stay in cache.
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Simulation Settings", meta = (ClampMin = "0"))
+	int32 MaxParallelWorkers = 0;													// 0 uses every task graph worker.
+
+public:
+	/* Return the scale applied to the world gravity */
+	float GetGravityScale() const { return GravityScale; }
+
+	/* Return the collision radius given to every fired projectile */
+	float GetCollisionRadius() const { return CollisionRadius; }
+
+	/* Return the fraction of the velocity lost per second */
+	float GetLinearDrag() const { return LinearDrag; }
+
+	/* Return the speed the projectiles are clamped to, 0 is unlimited */
+	float GetMaxSpeed() const { return MaxSpeed; }
+
+	/* Return if the orientation is kept facing along the velocity */
+	bool GetRotationFollowsVelocity() const { return bRotationFollowsVelocity; }
+
+	/* Return if the vectorized kernel is used instead of the scalar reference */
+	bool GetUseVectorizedKernel() const { return bUseVectorizedKernel; }
+
+	/* Return the lifetime of a projectile, 0 never expires */
+	float GetMaxLifetime() const { return MaxLifetime; }
+
+	/* Return if the chunks are spread over the task graph */
+	bool GetSimulateInParallel() const { return bSimulateInParallel; }
+
+	/* Return the chunk size, rounded up so every chunk but the last fills whole vector registers */
+	int32 GetParallelChunkSize() const { return Align(FMath::Max(ParallelChunkSize, 4), 4); }
+
+	/* Return the max number of workers, 0 uses every task graph worker */
+	int32 GetMaxParallelWorkers() const { return MaxParallelWorkers; }
+
+public:
+	FProjectileManagerSimulationSettings()
+	{}
+};
+
+/* The Struct that defines how the pool follows demand */
+USTRUCT(BlueprintType)
+struct FProjectileManagerAutoscaleSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Autoscale Settings")
+	bool bEnableAutoscaling = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Autoscale Settings", meta = (ClampMin = "0.0"))
+	float GrowHeadroom = 0.25f;										/* Capacity kept above the high water mark, as a fraction of it */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Autoscale Settings", meta = (ClampMin = "0.01"))
+	float HighWaterHalfLife = 10.f;									/* Seconds for the high water mark to decay halfway to the in use count */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Autoscale Settings", meta = (ClampMin = "0.0"))
+	float ShrinkCooldown = 15.f;									/* Seconds the pool must be over sized before it shrinks */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Autoscale Settings", meta = (ClampMin = "0"))
+	int32 MinPoolSize = 0;											/* The pool never shrinks below this, 0 uses the starting pool size */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Autoscale Settings", meta = (ClampMin = "0"))
+	int32 MaxPoolSize = 0;											/* The pool never grows past this, 0 is unlimited */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Autoscale Settings")
+	bool bGrowOnExhaustion = true;									/* An acquire on an empty pool spawns what it needs right away instead of failing */
+
+public:
+	/* Return if the pool follows demand */
+	bool IsEnabled() const { return bEnableAutoscaling; }
+
+	/* Return the headroom fraction */
+	float GetGrowHeadroom() const { return FMath::Max(GrowHeadroom, 0.f); }
+
+	/* Return the decay of the high water mark over a step */
+	float GetHighWaterDecay(float DeltaTime) const { return FMath::Exp(-0.69314718f * DeltaTime / FMath::Max(HighWaterHalfLife, 0.01f)); }
+
+	/* Return the over sized time needed before a shrink */
+	float GetShrinkCooldown() const { return FMath::Max(ShrinkCooldown, 0.f); }
+
+	/* Return the smallest pool size, given the starting size */
+	int32 GetMinPoolSize(int32 InStartingPoolSize) const { return FMath::Max(1, MinPoolSize > 0 ? MinPoolSize : InStartingPoolSize); }
+
+	/* Return the largest pool size */
+	int32 GetMaxPoolSize() const { return MaxPoolSize > 0 ? MaxPoolSize : MAX_int32; }
+
+	/* Return if an exhausted acquire grows the pool on the spot */
+	bool ShouldGrowOnExhaustion() const { return bEnableAutoscaling && bGrowOnExhaustion; }
+
+public:
+	FProjectileManagerAutoscaleSettings()
+	{}
+};
+
+/* The Struct that defines one reduced rate significance bucket */
+USTRUCT(BlueprintType)
+struct FProjectileSignificanceBucket
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Significance Bucket", meta = (ClampMin = "0.0"))
+	float MinDistance = 5000.f;										/* Distance from the closest viewpoint a projectile must be past */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Significance Bucket", meta = (ClampMin = "0.0"))
+	float MinTimeSinceFire = 0.f;									/* Seconds a projectile must have been flying for */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Significance Bucket", meta = (ClampMin = "0.0"))
+	float StepInterval = 0.1f;										/* Seconds between steps, each step covers the time since the last */
+
+public:
+	/* Return the distance squared a projectile must be past */
+	float GetMinDistanceSquared() const { return FMath::Square(FMath::Max(MinDistance, 0.f)); }
+
+	/* Return the time a projectile must have been flying for */
+	float GetMinTimeSinceFire() const { return FMath::Max(MinTimeSinceFire, 0.f); }
+
+	/* Return the seconds between steps */
+	float GetStepInterval() const { return FMath::Max(StepInterval, 0.f); }
+
+public:
+	FProjectileSignificanceBucket()
+	{}
+};
+
+/*	The Struct that defines how far and old projectiles are stepped at a reduced rate. A projectile 
+	steps at the last bucket whose distance and time since fire it is both past, the buckets are 
+	expected from near to far. Outside every bucket it steps at full rate. 
+*/
+USTRUCT(BlueprintType)
+struct FProjectileManagerSignificanceSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Significance Settings")
+	bool bEnableSignificance = false;								/* Only used by the actor pool */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Significance Settings")
+	TArray<FProjectileSignificanceBucket> Buckets;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Significance Settings", meta = (ClampMin = "0.0"))
+	float ReevaluateInterval = 0.25f;								/* Seconds between significance passes, 0 is every frame */
+
+public:
+	/* Return if the significance pass runs */
+	bool IsEnabled() const { return bEnableSignificance && Buckets.Num() > 0; }
+
+	/* Return the buckets, near to far */
+	const TArray<FProjectileSignificanceBucket>& GetBuckets() const { return Buckets; }
+
+	/* Return the seconds between passes */
+	float GetReevaluateInterval() const { return FMath::Max(ReevaluateInterval, 0.f); }
+
+public:
+	FProjectileManagerSignificanceSettings()
+	{}
+};
+
+/* The Struct that reports what the last significance pass found */
+USTRUCT(BlueprintType)
+struct FProjectileSignificanceStats
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Significance Stats")
+	int32 NumFullRate = 0;											/* Live projectiles outside every bucket */
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Significance Stats")
+	int32 NumReduced = 0;											/* Live projectiles stepping at a bucket rate */
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Significance Stats")
+	float StepsSavedPerSecond = 0.f;								/* Movement steps a second the buckets save, against stepping every frame */
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Significance Stats")
+	int32 BatchedStepsSkipped = 0;									/* Steps the batched tick skipped last frame, only counted when the manager ticks */
+
+public:
+	FProjectileSignificanceStats()
+	{}
+};
+
+/* The Struct that reports how the pool is being used */
+USTRUCT(BlueprintType)
+struct FProjectilePoolTelemetry
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	int32 InUseCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	int32 PeakInUseCount = 0;										/* The most ever in use at once */
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	float HighWaterMark = 0.f;										/* Follows the in use count up at once, and decays back down */
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	int32 AcquireMisses = 0;										/* Acquires that found the pool empty */
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	int32 AcquireFailures = 0;										/* Acquires that failed, after any growth on exhaustion */
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	int32 GrowCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	int32 ShrinkCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	float OversizedTime = 0.f;										/* How long the pool has been bigger than the demand wants */
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	int32 RenderedInstances = 0;									/* Live projectiles drawn by the instanced mesh last frame */
+
+	UPROPERTY(BlueprintReadOnly, Category = "Projectile Pool Telemetry")
+	float InstanceUpdateMilliseconds = 0.f;							/* Time the last instanced mesh update took on the game thread */
+
+public:
+	/* Records the in use count of this step */
+	void SampleInUse(int32 InInUseCount, float InHighWaterDecay)
+	{
+		InUseCount = InInUseCount;
+		PeakInUseCount = FMath::Max(PeakInUseCount, InInUseCount);
+		HighWaterMark = FMath::Max(float(InInUseCount), HighWaterMark * InHighWaterDecay);
+	}
+
+public:
+	FProjectilePoolTelemetry()
+	{}
+};
+
+/*	The Struct that holds the pool of one projectile class. The slot pool owns which entries are 
+	free, reserved, in use or tombstoned, their generations and the free list. The entries are 
+	the projectiles of those slots, index for index, kept as properties so the collector sees 
+	them. The free list is lock free so slots can be reserved off the game thread, anything that 
+	resizes the slots or the entries holds the managers pool lock for writing. 
+*/
+USTRUCT()
+struct FManagedProjectileSubPool
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Properties -- //
+public:
+	UPROPERTY()
+	TSubclassOf<AManagedProjectileBase> ProjectileClass;
+
+	UPROPERTY()
+	int32 StartingPoolSize = 0;
+
+	UPROPERTY()
+	TArray<FManagedProjectileEntry> Entries;
+
+	/* The state of each entry, the same index as the entries */
+	FManagedProjectileSlotPool Slots;
+
+	UPROPERTY()
+	int32 PendingRemovalCount = 0;			// The number of entries still to remove as they are returned, from a shrink that hit in use entries.
+
+	UPROPERTY()
+	int32 PendingCreationTarget = 0;		// The size a time sliced creation is building toward, 0 when not creating.
+
+	UPROPERTY()
+	int32 CreationStartSize = 0;			// The size when the current creation started.
+
+	UPROPERTY()
+	FProjectilePoolTelemetry Telemetry;
+
+	UPROPERTY()
+	UStaticMesh* InstanceMesh = nullptr;
+
+	UPROPERTY()
+	UInstancedStaticMeshComponent* InstanceComponent = nullptr;	// Draws the live projectiles of this class, only set in the instanced mesh render mode.
+
+	UPROPERTY()
+	int32 NumRenderedInstances = 0;			// The instances showing a live projectile after the last update, the rest are hidden.
+
+	/* The instance transforms written each update, kept to reuse the allocation */
+	TArray<FTransform> InstanceTransforms;
+
+	// -- Public Information -- Methods -- //
+public:
+	/* The number of live entries, tombstones excluded */
+	int32 GetActorPoolSize() const { return Slots.GetCapacity() - Slots.GetNumEmpty(); }
+
+	/* The number of entries handed out, reserved ones included */
+	int32 GetInUseCount() const { return GetActorPoolSize() - Slots.NumFree(); }
+
+	/* Is the entry handed out and committed? */
+	bool IsEntryInUse(int32 InEntryIndex) const { return Slots.GetStateAt(InEntryIndex) == EProjectilePoolSlotState::Live; }
+
+	/* Is the entry a tombstone, a slot left behind by a shrink that can be refilled on grow? */
+	bool IsEntryTombstone(int32 InEntryIndex) const { return Slots.GetStateAt(InEntryIndex) == EProjectilePoolSlotState::Empty; }
+
+	/* The generation of the current use of an entry */
+	int32 GetEntryGeneration(int32 InEntryIndex) const { return Slots.GetGenerationAt(InEntryIndex); }
+
+	/* Is a time sliced creation building this pool? */
+	bool IsCreating() const { return PendingCreationTarget > 0; }
+
+	/* Does the manager draw this pool as an instanced mesh? */
+	bool IsRenderInstanced() const { return InstanceComponent != nullptr; }
+
+	/* The class this pool spawns */
+	UClass* GetProjectileClass() const { return ProjectileClass; }
+
+	/* Adds a spawned projectile, refilling tombstones before appending */
+	void AddProjectile(AManagedProjectileBase* InProjectile, int32& InOutTombstoneCursor);
+
+	/* Pops the head of the free list and reserves it, any thread */
+	int32 PopFreeEntry();
+
+	/* Pops and reserves entries off the free list until there are enough or the pool is exhausted */
+	int32 PopFreeEntries(int32 InNumWanted, TArray<int32>& OutEntryIndexs);
+
+	/* Hands out a reserved entry, returns the generation of its use */
+	int32 CommitEntry(int32 InEntryIndex);
+
+	/* Hands out the entry reserved off thread for the handle, false if the reservation no longer holds */
+	bool CommitReservedEntry(const FProjectileHandle& InHandle);
+
+	/* Frees an in use entry and pushes it onto the head of the free list */
+	void PushFreeEntry(int32 InEntryIndex);
+
+	/* Takes every entry off the free list, so no other thread can reserve one */
+	void ClearFreeList();
+
+	/* Rebuilds the free list by walking every entry */
+	void RebuildFreeList();
+
+	/* Tombstones free entries from the back, the free list is left stale */
+	int32 TombstoneFreeEntries(int32 InNumWantingToRemove);
+
+	/* Destroys the projectile in an entry, leaving the slot behind */
+	void TombstoneEntry(int32 InEntryIndex);
+
+	/* Drops the tombstones from the back */
+	void TrimTrailingTombstones();
+
+	/* Resolves a handle to the entry it was issued for */
+	int32 ResolveHandle(const FProjectileHandle& InHandle) const;
+
+	/* Destroys every projectile and empties the entries and the slots, the free list is cleared by the manager first */
+	void CleanUp();
+
+public:
+	FManagedProjectileSubPool()
+	{}
+
+	explicit FManagedProjectileSubPool(UClass* InProjectileClass, int32 InStartingPoolSize)
+	{
+		ProjectileClass = InProjectileClass;
+		StartingPoolSize = InStartingPoolSize;
+	}
+};
+
+/* A pull reserved or a return requested off the game thread, applied by the game thread */
+struct FProjectileAsyncCommand
+{
+	FProjectileHandle ProjectileHandle;
+	FProjectilePoolRequest PullRequest;											/* Unused by a return */
+	bool bIsReturn = false;
+
+	FProjectileAsyncCommand()
+	{}
+
+	explicit FProjectileAsyncCommand(const FProjectileHandle& InHandle, const FProjectilePoolRequest& InPullRequest, bool bInIsReturn)
+	{
+		ProjectileHandle = InHandle;
+		PullRequest = InPullRequest;
+		bIsReturn = bInIsReturn;
+	}
+};
+
+/* The Struct that defines how the manager finds projectile hits */
+USTRUCT(BlueprintType)
+struct FProjectileManagerCollisionSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Collision Settings")
+	EProjectileCollisionMode CollisionMode = EProjectileCollisionMode::ComponentOverlap;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Collision Settings")
+	TEnumAsByte<ECollisionChannel> SweepChannel = ECC_WorldDynamic;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Collision Settings")
+	bool bTraceComplex = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Collision Settings")
+	bool bIgnoreOwningActor = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Collision Settings")
+	bool bReturnOnHit = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Collision Settings")
+	bool bTestRegisteredTargets = false;							/* Test the projectiles against the registered targets, their physics overlaps are turned off */
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Collision Settings", meta = (ClampMin = "1.0"))
+	float TargetCellSize = 500.f;									/* Edge length of a target grid cell, around the size of a typical target */
+
+public:
+	/* Return if the manager sweeps for the hits */
+	bool UseAsyncSweeps() const { return CollisionMode == EProjectileCollisionMode::AsyncSweep; }
+
+	/* Return the channel the sweeps run on */
+	ECollisionChannel GetSweepChannel() const { return SweepChannel; }
+
+	/* Return if the sweeps trace against complex collision */
+	bool GetTraceComplex() const { return bTraceComplex; }
+
+	/* Return if the sweeps ignore the actor that fired the projectile */
+	bool GetIgnoreOwningActor() const { return bIgnoreOwningActor; }
+
+	/* Return if a hit returns the projectile to the pool */
+	bool GetReturnOnHit() const { return bReturnOnHit; }
+
+	/* Return if the manager tests the registered targets */
+	bool GetTestRegisteredTargets() const { return bTestRegisteredTargets; }
+
+	/* Return the edge length of a target grid cell */
+	float GetTargetCellSize() const { return FMath::Max(TargetCellSize, 1.f); }
+
+public:
+	FProjectileManagerCollisionSettings()
+	{}
+};
+
+/* The Struct that defines the global setting  */
+USTRUCT(BlueprintType)
+struct FProjectileManagerGlobalSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
+	bool bAllowForProjectilesTickAsync = false;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
+	bool bAllowAsyncPullFromPool = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
+	bool bAllowAsyncReturnToPool = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Manager Global Settings")
+	float AsyncTaskWaitTime = 0.0083f;	// default of 120fps, how often the async requests and fire commands are applied, 0 is every frame
+
+public:
+	bool AllowForProjectilesToTickAsync() { return bAllowForProjectilesTickAsync; }
+
+	bool AllowAsyncPullFromPool() const { return bAllowAsyncPullFromPool; }
+
+	bool AllowAsyncReturnToPool() const { return bAllowAsyncReturnToPool; }
+
+	float GetAsyncWaitTime() const { return AsyncTaskWaitTime; }
+
+	bool AllowAnyAsyncRequests() const { return bAllowAsyncPullFromPool || bAllowAsyncReturnToPool; }
+
+public:
+	FProjectileManagerGlobalSettings()
+	{}
+};
+
+
+/* The tick function the manager uses to process queued returns once per frame. */
+USTRUCT()
+struct FProjectileManagerReturnTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Properties -- //
+public:
+	class AProjectileManagerBase* Target = nullptr;							/* The manager to process the returns for */
+
+	// -- Public Information -- FTickFunction Interface -- //
+public:
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FProjectileManagerReturnTickFunction> : public TStructOpsTypeTraitsBase2<FProjectileManagerReturnTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/* The tick function the manager uses to move every live projectile in one dispatch. */
+USTRUCT()
+struct FProjectileManagerBatchTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Properties -- //
+public:
+	class AProjectileManagerBase* Target = nullptr;							/* The manager whose projectiles are moved */
+
+	// -- Public Information -- FTickFunction Interface -- //
+public:
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FProjectileManagerBatchTickFunction> : public TStructOpsTypeTraitsBase2<FProjectileManagerBatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/* The tick function the manager uses to write the live projectiles into the instanced meshes once per frame. */
+USTRUCT()
+struct FProjectileManagerInstanceTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Properties -- //
+public:
+	class AProjectileManagerBase* Target = nullptr;							/* The manager whose projectiles are drawn */
+
+	// -- Public Information -- FTickFunction Interface -- //
+public:
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FProjectileManagerInstanceTickFunction> : public TStructOpsTypeTraitsBase2<FProjectileManagerInstanceTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Base Class Declariations										-
+//-----------------------------------------------------------------------------------
+UCLASS()
+class PROJECTILEMANAGER_API AProjectileManagerBase : public AActor
+{
+	GENERATED_BODY()
+	
+	// -- Public Information -- Projectile Manager Constructor and Engine Events -- //
+public:	
+	AProjectileManagerBase();
+
+	virtual void BeginPlay() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// -- Public Information -- Projectile Manager Methods -- //
+public:
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	virtual bool Request_ResizeProjectilePool(UPARAM(ref)int32& InNewProjectilePoolSize);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	virtual bool Request_ResizeProjectileSubPool(int32 InClassId, UPARAM(ref)int32& InNewProjectilePoolSize);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	virtual bool Request_GetProjectileFromManager(AManagedProjectileBase*& OutProjectileToUse, UPARAM(ref) FProjectilePoolRequest& RetreieveSettings);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	virtual bool Request_GetProjectileHandleFromManager(FProjectileHandle& OutHandle, AManagedProjectileBase*& OutProjectileToUse, UPARAM(ref) FProjectilePoolRequest& RetreieveSettings);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	virtual bool Request_GetProjectileOfClassFromManager(int32 InClassId, FProjectileHandle& OutHandle, AManagedProjectileBase*& OutProjectileToUse, UPARAM(ref) FProjectilePoolRequest& RetreieveSettings);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	virtual bool Request_GetProjectileBurstFromManager(TArray<AManagedProjectileBase*>& OutProjectilesToUse, TArray<FProjectileHandle>& OutHandles, const TArray<FProjectilePoolRequest>& RetreieveSettings);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	virtual bool Request_GetProjectileBurstOfClassFromManager(int32 InClassId, TArray<AManagedProjectileBase*>& OutProjectilesToUse, TArray<FProjectileHandle>& OutHandles, const TArray<FProjectilePoolRequest>& RetreieveSettings);
+
+	/* Native burst, the generator fills in the request for each index of the burst. */
+	virtual bool Request_GenerateProjectileBurstFromManager(int32 InBurstCount, TFunctionRef<void(int32, FProjectilePoolRequest&)> RequestGenerator, TArray<AManagedProjectileBase*>& OutProjectilesToUse, TArray<FProjectileHandle>& OutHandles, int32 InClassId = 0);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	virtual bool Request_ReturnProjectileToManager(UPARAM(ref) AManagedProjectileBase*& InProjectileToReturn);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	virtual bool Request_ReturnProjectileHandleToManager(const FProjectileHandle& InHandle);
+
+	/* Reserves a projectile from any thread, the pull is applied on the game thread by the next manager tick */
+	bool Request_GetProjectileAsync(int32 InClassId, const FProjectilePoolRequest& InRetreieveSettings, FProjectileHandle& OutHandle);
+
+	/* Returns a projectile from any thread, the return is applied on the game thread by the next manager tick */
+	bool Request_ReturnProjectileAsync(const FProjectileHandle& InHandle);
+
+	/* Appends a fire command from any thread, applied with the rest of the buffer in one game thread pass */
+	bool Request_EnqueueFire(FProjectileFireCommand InCommand);
+
+	/* Appends a batch of fire commands from any thread under one lock, the batch is left empty */
+	bool Request_EnqueueFireBatch(TArray<FProjectileFireCommand>& InOutCommands);
+
+	/* Appends a fire command from any thread, the future is set with the handle once it was applied */
+	TFuture<FProjectileHandle> Request_EnqueueFireWithFuture(FProjectileFireCommand InCommand);
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	bool IsProjectileHandleAlive(const FProjectileHandle& InHandle) const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	AManagedProjectileBase* GetProjectileFromHandle(const FProjectileHandle& InHandle) const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	int32 GetProjectileClassId(TSubclassOf<AManagedProjectileBase> InProjectileClass) const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	int32 GetNumProjectileClasses() const { return SubPools.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	FName GetManagerTag() const { return InitSettings.GetManagerTag(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base | Simulation")
+	virtual bool Request_FireSimulatedProjectile(FProjectileHandle& OutHandle, const FProjectilePoolRequest& FireSettings);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base | Simulation")
+	virtual bool Request_ReturnSimulatedProjectile(const FProjectileHandle& InHandle);
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base | Simulation")
+	bool GetSimulatedProjectileState(const FProjectileHandle& InHandle, FVector& OutLocation, FVector& OutVelocity) const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base | Simulation")
+	int32 GetSimulatedProjectileCount() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base")
+	int32 GetCurrentPoolSize() const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	int32 GetSubPoolSize(int32 InClassId) const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	bool IsCreatingPool() const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	float GetPoolCreationProgress() const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	FProjectilePoolTelemetry GetPoolTelemetry(int32 InClassId = 0) const;
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base")
+	int32 GetInUseCount() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base | Targets")
+	int32 Request_RegisterProjectileTarget(const FProjectileTargetDescription& InDescription);
+
+	/* Native registration, the callback runs for this target only */
+	int32 Request_RegisterProjectileTargetWithCallback(const FProjectileTargetDescription& InDescription, const FOnProjectileTargetTouched& InCallback);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base | Targets")
+	bool Request_UnregisterProjectileTarget(int32 InTargetId);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base | Targets")
+	bool Request_MoveProjectileTarget(int32 InTargetId, FVector InNewCenter);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base | Significance")
+	bool Request_RegisterSignificanceViewpoint(AActor* InViewpoint);
+
+	UFUNCTION(BlueprintCallable, Category = "Projectile Manager Base | Significance")
+	bool Request_UnregisterSignificanceViewpoint(AActor* InViewpoint);
+
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager Base | Significance")
+	FProjectileSignificanceStats GetSignificanceStats() const { return SignificanceStats; }
+
+	/* Processes every return queued this frame in one pass, called by the return tick function. */
+	void ProcessPendingReturns();
+
+	/* Applies the pulls and returns requested off the game thread. */
+	void Process_AsyncCommands();
+
+	/* Applies every buffered fire command, one burst pull per class. */
+	void Process_FireCommands();
+
+	/* Hands the fire pass scratch back for reuse, unless a re-entrant pass already has. */
+	void Restore_FireScratch(TArray<FProjectileFireCommand>& InCommands, TArray<AManagedProjectileBase*>& InProjectiles, TArray<FProjectileHandle>& InHandles);
+
+	/* Moves every live projectile in pool order, called by the batch tick function. */
+	void Tick_BatchedProjectiles(float DeltaTime);
+
+	/* Writes every live projectile into its classes instanced mesh, called by the instance tick function. */
+	void Update_InstancedRendering();
+
+	// -- Private Information -- Projectile Manager Internal Methods -- //
+private:
+	/* Creates a sub pool per projectile class and indexes them by class */
+	void Create_SubPools();
+
+	/* Creates the instanced mesh of each sub pool that has a mesh to draw */
+	void Create_InstanceComponents();
+
+	/* Destroys the instanced meshes */
+	void CleanUp_InstanceComponents();
+
+	/* Creates a Projectile Pool, allocates space via the spawn */
+	virtual bool Create_ProjectilePool(int32 InClassId, int32 DesiredSize);
+
+	/* Spawns up to the number of projectiles into a sub pool, stopping once the budget is spent */
+	int32 Spawn_PooledProjectiles(int32 InClassId, int32 InAmountToSpawn, double InBudgetSeconds);
+
+	/* Spends this frames creation budget, raising the progress and completion events */
+	void Advance_PoolCreation();
+
+	/* Stops any creation still in progress, the projectiles already spawned stay in the pool */
+	void Cancel_PoolCreation(int32 InClassId);
+
+	/* Turns the actor tick on only while there is per frame work */
+	void RefreshManagerTickEnabled();
+
+	/* Reports the in use count and the pool size to the stats */
+	void Report_PoolOccupancy() const;
+
+	/* Samples the demand and grows or shrinks the pools to follow it */
+	void Update_Autoscaling(float DeltaTime);
+
+	/* Buckets the live projectiles by distance to the viewpoints and time since fire, and sets their step rate */
+	void Update_Significance(float DeltaTime);
+
+	/* Gathers the registered viewpoints, or the player view points when none are registered */
+	void Gather_SignificanceViewLocations();
+
+	/* Grows an exhausted pool right away so an acquire does not fail, returns the number added */
+	int32 Grow_OnExhaustion(int32 InClassId, int32 InNumNeeded);
+
+	/* The pool size the demand currently wants, headroom included */
+	int32 GetAutoscaleTargetSize(int32 InClassId) const;
+
+	/* Advances every live simulated projectile */
+	virtual void Simulate_ProjectileData(float DeltaTime);
+
+	/* Advances one chunk of the simulated projectiles and records what it found, safe to run on any worker */
+	void Simulate_ProjectileChunk(int32 InChunkIndex, int32 InChunkSize, float DeltaTime, const struct FProjectileBallisticParams& Params, float KillZ);
+
+	/* Merges the chunk results on the game thread, expired projectiles are removed */
+	void Resolve_ProjectileChunkResults();
+
+	/* Issues one async sweep per live projectile that wants collision, covering its last move */
+	void Issue_AsyncSweeps(float DeltaTime);
+
+	/* Consumes the async sweeps issued last frame, hits raise events and return the projectiles */
+	void Consume_AsyncSweeps();
+
+	/* Tests the live projectiles against the registered targets */
+	void Test_RegisteredTargets();
+
+	/* Returns a projectile that hit something, if the settings ask for it and it is still alive */
+	void Return_HitProjectile(const FProjectileHandle& InHandle);
+
+	/* Returns a live projectile of either mode by its handle */
+	void Return_ProjectileByHandle(const FProjectileHandle& InHandle);
+
+	/* Removes a live actorless projectile, counted and reported as a return */
+	void Return_SimulatedProjectileAt(int32 DenseIndex);
+
+	/* Schedules the lifetime and travel limit of a projectile use */
+	void Schedule_Expiry(const FProjectileHandle& InHandle, const FProjectilePoolRequest& InRequest, float InLifetimeCap = 0.f);
+
+	/* Returns every projectile whose lifetime or travel limit ran out */
+	void Update_Expiry(float DeltaTime);
+
+	/* Raises the expiry events, the simulated one as well in data mode */
+	void Broadcast_ProjectileExpired(const FProjectileHandle& InHandle, const FVector& InLocation);
+
+	/* Gets where a live projectile of either mode is and how fast it is going */
+	bool GetLiveProjectileState(const FProjectileHandle& InHandle, FVector& OutLocation, FVector& OutVelocity) const;
+
+	/* Resizes a projectile pool to a specific size, destroys or creates as needed */
+	virtual bool Resize_ProjectilePool(int32 InClassId, int32& InNewProjectilePoolSize);
+
+	/* Cleans Up the projectile pool, basically a destroy all */
+	virtual bool CleanUp_ProjectilePool();
+
+	/* Marks a popped entry in use under a fresh generation and issues its handle */
+	AManagedProjectileBase* AcquireEntry(int32 InClassId, int32 InEntryIndex, FProjectileHandle& OutHandle);
+
+	/* Resolves a handle to its entry index in the handles sub pool, -1 if the handle is stale or was never issued */
+	int32 ResolveHandle(const FProjectileHandle& InHandle) const;
+
+	/* Is the handle a projectile of either mode still in flight, not stale and not queued for return? */
+	bool IsProjectileInFlight(const FProjectileHandle& InHandle) const;
+
+	/* Returns the entry at the resolved index to the pool */
+	bool ReturnEntryToPool(int32 InClassId, int32 InEntryIndex);
+
+	/* Queues the entry at the resolved index for the end of frame return pass */
+	bool QueueEntryForReturn(int32 InClassId, int32 InEntryIndex);
+
+	/* Applies a pull request to a freshly acquired entry, collision is left to the manager when it sweeps */
+	bool ApplyPullRequest(int32 InClassId, int32 InEntryIndex, const FProjectilePoolRequest& InRequest);
+
+	/* Applies a pool request with its movement and overlap updates deferred to one pass */
+	bool ApplyPoolRequestDeferred(AManagedProjectileBase* InProjectile, const FProjectilePoolRequest& InRequest);
+
+	// -- Private Information -- Settings Methods -- //
+private:
+	/* Does the actor start with collision enabled? */
+	bool InitProjectilesWithCollisionEnabled() const { return InitSettings.GetStartWithCollision(); }
+
+	bool OptimizeProjectilesMustTickAsync() { return GlobalSettings.AllowForProjectilesToTickAsync(); }
+
+	/* What is the init pool size? */
+	int32 GetInitProjectilePoolSize() const { return InitSettings.GetStartingPoolSize(); }
+
+	/* WHere does the pool store the projectiles in the world? */
+	FVector GetPoolLocation() const { return RetrieveReturnSettings.ReturnProjectileRequest.GetStartLocation(); }
+
+	/* Return the settings */
+	FProjectilePoolRequest GetReturnRequestSettings() const { return RetrieveReturnSettings.ReturnProjectileRequest; }
+
+	/* Are returns queued for the end of frame pass? */
+	bool ShouldDeferReturns() const { return RetrieveReturnSettings.DeferReturnsToEndOfFrame(); }
+
+	/* What class do we work with? */
+	UClass* GetProjectileClassToUse() const { return InitSettings.GetProjectileClassToSpawn(); }
+
+	/* Does the manager sweep for the projectile hits? */
+	bool ShouldUseAsyncSweeps() const { return CollisionSettings.UseAsyncSweeps(); }
+
+	/* Does the manager test the registered targets? */
+	bool ShouldTestRegisteredTargets() const { return CollisionSettings.GetTestRegisteredTargets(); }
+
+	/* Is the collision done by the manager instead of the projectile components? */
+	bool IsCollisionManaged() const { return ShouldUseAsyncSweeps() || ShouldTestRegisteredTargets(); }
+
+	/* Does the pool follow demand? */
+	bool ShouldAutoscale() const { return AutoscaleSettings.IsEnabled(); }
+
+	/* Are the projectiles actorless data instead of pooled actors? */
+	bool IsDataSimulationMode() const { return InitSettings.GetPoolMode() == EProjectilePoolMode::DataSimulation; }
+
+	/* Does the manager tick the pooled projectiles? */
+	bool IsTickBatched() const { return !IsDataSimulationMode() && InitSettings.GetTickMode() == EProjectileTickMode::ManagerBatched; }
+
+	/* Does the manager draw the projectiles as instanced meshes? */
+	bool IsRenderInstanced() const { return !IsDataSimulationMode() && InitSettings.GetRenderMode() == EProjectileRenderMode::InstancedMesh; }
+
+	/* The return settings of a class, an instanced class keeps its actors hidden */
+	FProjectilePoolRequest GetReturnRequestOfClass(int32 InClassId) const
+	{
+		FProjectilePoolRequest Request = RetrieveReturnSettings.ReturnProjectileRequest;
+		Request.bHideAfterPoolRequest |= IsValidClassId(InClassId) && SubPools[InClassId].IsRenderInstanced();
+		return Request;
+	}
+
+	/* Are far and old projectiles stepped at a reduced rate? */
+	bool ShouldEvaluateSignificance() const { return !IsDataSimulationMode() && SignificanceSettings.IsEnabled(); }
+
+	/* Are returned projectiles parked with their components unregistered? */
+	bool ShouldParkUnregistered() const { return !IsDataSimulationMode() && RetrieveReturnSettings.GetParkingMode() == EProjectileParkingMode::Unregister; }
+
+	/* Is the class id one of our sub pools? */
+	bool IsValidClassId(int32 InClassId) const { return SubPools.IsValidIndex(InClassId); }
+
+	/* The number of live entries in a sub pool, tombstones excluded */
+	int32 GetActorPoolSize(int32 InClassId) const { return IsValidClassId(InClassId) ? SubPools[InClassId].GetActorPoolSize() : 0; }
+
+	/* The pool size of a class, the data capacity in the data simulation mode */
+	int32 GetPoolSizeOf(int32 InClassId) const { return IsDataSimulationMode() ? SimulationData.GetCapacity() : GetActorPoolSize(InClassId); }
+
+	/* The number handed out of a class, the live data in the data simulation mode */
+	int32 GetInUseCountOf(int32 InClassId) const { return IsDataSimulationMode() ? SimulationData.Num() : (IsValidClassId(InClassId) ? SubPools[InClassId].GetInUseCount() : 0); }
+
+
+	// -- Public Information -- Projectile Manager Exposed Properties -- //
+public:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Init ")
+	FProjectileManagerInitSettings InitSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Retrieve / Return  ")
+	FProjectileManagerRetrieveReturnSettings RetrieveReturnSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Global ")
+	FProjectileManagerGlobalSettings GlobalSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Simulation ")
+	FProjectileManagerSimulationSettings SimulationSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Collision ")
+	FProjectileManagerCollisionSettings CollisionSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Autoscale ")
+	FProjectileManagerAutoscaleSettings AutoscaleSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Projectile Manager | Settings | Significance ")
+	FProjectileManagerSignificanceSettings SignificanceSettings;
+
+	UPROPERTY()
+	TArray<FManagedProjectileSubPool> SubPools;		// One pool per projectile class, the index is the class id.
+
+	UPROPERTY()
+	TMap<UClass*, int32> ClassIdsByClass;			// Finds the class id of a projectile class.
+
+	UPROPERTY()
+	TArray<FProjectileHandle> PendingReturnHandles;	// Handles queued for the end of frame return pass.
+
+	UPROPERTY()
+	TArray<TWeakObjectPtr<AActor>> SignificanceViewpoints;	// The actors projectiles are near or far from, the players when empty.
+
+	UPROPERTY()
+	FProjectileSignificanceStats SignificanceStats;
+
+	/* The viewpoint locations of the current significance pass */
+	TArray<FVector> SignificanceViewLocations;
+
+	/* The time since the last significance pass */
+	float SignificanceTimer = 0.f;
+
+	/* Held for reading while a slot is reserved off thread, for writing while the pools or their free slots are resized */
+	FRWLock PoolLock;
+
+	/* The pulls and returns requested off the game thread, many producers and the game thread consuming */
+	TQueue<FProjectileAsyncCommand, EQueueMode::Mpsc> AsyncCommands;
+
+	/* The fire commands appended by any thread, and the ones being applied, reused every drain */
+	FProjectileFireCommandBuffer FireCommandBuffer;
+	TArray<FProjectileFireCommand> DrainedFireCommands;
+	TArray<AManagedProjectileBase*> FiredProjectiles;
+	TArray<FProjectileHandle> FiredHandles;
+
+	/* The time since the async requests and fire commands were last applied */
+	float AsyncDrainTimer = 0.f;
+
+	UPROPERTY()
+	FProjectileManagerReturnTickFunction ReturnTickFunction;
+
+	UPROPERTY()
+	FProjectileManagerBatchTickFunction BatchTickFunction;
+
+	UPROPERTY()
+	FProjectileManagerInstanceTickFunction InstanceTickFunction;
+
+	UPROPERTY(Transient)
+	FProjectileSimulationData SimulationData;
+
+	UPROPERTY(BlueprintAssignable, Category = "Projectile Manager | Pool")
+	FOnProjectilePoolCreationProgress OnPoolCreationProgress;
+
+	UPROPERTY(BlueprintAssignable, Category = "Projectile Manager | Pool")
+	FOnProjectilePoolCreationComplete OnPoolCreationComplete;
+
+	/* Data mode only, raised alongside OnManagedProjectileExpired for every lifetime, travel or kill z expiry */
+	UPROPERTY(BlueprintAssignable, Category = "Projectile Manager | Simulation")
+	FOnSimulatedProjectileExpired OnSimulatedProjectileExpired;
+
+	/* One result per chunk of the last simulation step, reused every frame */
+	TArray<FProjectileSimulationChunkResult> SimulationChunkResults;
+
+	UPROPERTY(BlueprintAssignable, Category = "Projectile Manager | Collision")
+	FOnManagedProjectileHit OnManagedProjectileHit;
+
+	/* The sweeps issued last frame and the projectile each one was for */
+	TArray<TPair<FTraceHandle, FProjectileHandle>> PendingAsyncSweeps;
+
+	UPROPERTY(BlueprintAssignable, Category = "Projectile Manager | Targets")
+	FOnProjectileTargetHit OnProjectileTargetHit;
+
+	UPROPERTY(BlueprintAssignable, Category = "Projectile Manager | Async")
+	FOnAsyncProjectileAcquired OnAsyncProjectileAcquired;
+
+	/* The registered targets and their grid */
+	FProjectileTargetSpatialHash TargetHash;
+
+	/* Raised for every lifetime, travel or kill z expiry in either mode */
+	UPROPERTY(BlueprintAssignable, Category = "Projectile Manager | Expiry")
+	FOnManagedProjectileExpired OnManagedProjectileExpired;
+
+	/* The scheduled lifetimes and travel limits, and the expiries due this frame */
+	FProjectileExpiryWheel ExpiryWheel;
+	TArray<FProjectileExpiry> DueExpiries;
+
+	/* The touches found this frame, and the query scratch, reused every frame */
+	TArray<FProjectileTargetTouch> TargetTouches;
+	TArray<int32> TouchedTargetIds;
+};
@@ -0,0 +1,89 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "ProjectileManager/Public/Projectile/ManagedProjectileBase.h"
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Fire Command Structs													-
+//-----------------------------------------------------------------------------------
+/* Called on the game thread once a fire command was applied, the handle is unset if nothing was fired */
+typedef TFunction<void(const FProjectileHandle& /* ProjectileHandle */, AManagedProjectileBase* /* Projectile */)> FOnProjectileFireCommandApplied;
+
+/* A compact fire request any thread can append, turned into a pull request on the game thread */
+struct FProjectileFireCommand
+{
+	int32 ClassId = 0;														/* The class id to fire, the data simulation mode only has class id 0 */
+	FVector Location = FVector::ZeroVector;
+	FVector Direction = FVector::ForwardVector;
+	float Speed = 0.f;
+	float MaxLifetime = 0.f;												/* 0 never expires */
+	float MaxTravelDistance = 0.f;											/* 0 has no travel limit */
+	TEnumAsByte<ECollisionEnabled::Type> CollisionSettings = ECollisionEnabled::QueryOnly;
+	AActor* OwningActor = nullptr;
+	FOnProjectileFireCommandApplied OnApplied;								/* Optional */
+
+	/* Builds the pull request the command stands for */
+	FProjectilePoolRequest ToPoolRequest() const
+	{
+		FProjectilePoolRequest Request(true, false, CollisionSettings, Speed, Location, Direction);
+		Request.MaxLifetime = MaxLifetime;
+		Request.MaxTravelDistance = MaxTravelDistance;
+		Request.OwningActor = OwningActor;
+		return Request;
+	}
+
+	FProjectileFireCommand()
+	{}
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Fire Command Buffer													-
+//-----------------------------------------------------------------------------------
+/*	The fire commands appended since the last drain. Any thread appends under a short lock, the 
+	game thread takes the whole buffer in one swap, so the two arrays trade their allocations 
+	back and forth and nothing is allocated once both are warm. 
+*/
+struct PROJECTILEMANAGER_API FProjectileFireCommandBuffer
+{
+	// -- Public Information -- Any Thread -- //
+public:
+	/* Appends one command */
+	void Append(FProjectileFireCommand&& InCommand);
+
+	/* Appends a batch of commands under one lock, the batch is left empty */
+	void Append(TArray<FProjectileFireCommand>& InOutCommands);
+
+	/* Gets the number of commands waiting */
+	int32 Num() const;
+
+	// -- Public Information -- Game Thread -- //
+public:
+	/* Takes every waiting command, the out array should be empty and is swapped in as the new buffer */
+	int32 TakePending(TArray<FProjectileFireCommand>& OutCommands);
+
+	// -- Private Information -- Properties -- //
+private:
+	mutable FCriticalSection PendingLock;
+	TArray<FProjectileFireCommand> PendingCommands;
+};
@@ -0,0 +1,83 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Free Slot Stack														-
+//-----------------------------------------------------------------------------------
+/*	A lock free stack of free pool slots, a Treiber stack threaded through a link per slot. 
+	The head packs the top slot with a tag that changes on every push and pop, so a thread 
+	that read a head, stalled, and came back after the same slot was popped and pushed again 
+	fails its compare exchange instead of linking a stale next slot. Push and pop are safe from 
+	any thread, the links are only resized while no other thread can touch the stack. 
+*/
+struct PROJECTILEMANAGER_API FProjectileFreeSlotStack
+{
+	// -- Public Information -- Lock Free Methods -- //
+public:
+	/* Pushes a free slot, any thread */
+	void Push(int32 InSlot);
+
+	/* Pops a free slot, any thread, INDEX_NONE when empty */
+	int32 Pop();
+
+	/* Gets the number of free slots, only exact when no other thread is pushing or popping */
+	int32 Num() const { return FMath::Max(FPlatformAtomics::AtomicRead(&NumFree), 0); }
+
+	// -- Public Information -- Exclusive Methods -- //
+public:
+	/* Empties the stack and sizes the links, no other thread may touch the stack */
+	void Reset(int32 InCapacity = 0);
+
+	/* Resizes the links, no other thread may touch the stack */
+	void SetCapacity(int32 InCapacity) { Links.SetNum(InCapacity, false); }
+
+	// -- Private Information -- Helpers -- //
+private:
+	static int64 PackHead(int32 InSlot, uint32 InTag) { return int64((uint64(InTag) << 32) | uint64(uint32(InSlot))); }
+
+	static int32 GetHeadSlot(int64 InHead) { return int32(uint32(uint64(InHead))); }
+
+	static uint32 GetHeadTag(int64 InHead) { return uint32(uint64(InHead) >> 32); }
+
+	// -- Private Information -- Properties -- //
+private:
+	TArray<int32> Links;														/* The slot under each free slot */
+	volatile int64 Head = PackHead(INDEX_NONE, 0);
+	volatile int32 NumFree = 0;
+
+public:
+	FProjectileFreeSlotStack()
+	{}
+
+	FProjectileFreeSlotStack(const FProjectileFreeSlotStack& Other)
+		: Links(Other.Links), Head(Other.Head), NumFree(Other.NumFree)
+	{}
+
+	FProjectileFreeSlotStack& operator=(const FProjectileFreeSlotStack& Other)
+	{
+		Links = Other.Links;
+		Head = Other.Head;
+		NumFree = Other.NumFree;
+		return *this;
+	}
+};
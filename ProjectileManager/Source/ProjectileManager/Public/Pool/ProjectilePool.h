@@ -0,0 +1,749 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "ProjectileManager/Public/Pool/ProjectileFreeSlotStack.h"
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Pool Free Slot Strategies												-
+//-----------------------------------------------------------------------------------
+/* Hands out the slot freed last, the one most likely still in cache. */
+struct FProjectilePoolStackFreeSlots
+{
+	// -- Public Information -- Strategy Traits -- //
+public:
+	static constexpr bool bPushNewSlotsInReverse = true;					/* So the lowest new slot is handed out first */
+
+	// -- Public Information -- Methods -- //
+public:
+	void Reset() { Slots.Reset(); }
+
+	void Reserve(int32 InCapacity) { Slots.Reserve(InCapacity); }
+
+	void Push(int32 InSlot) { Slots.Add(InSlot); }
+
+	int32 Pop() { return Slots.Num() > 0 ? Slots.Pop(false) : INDEX_NONE; }
+
+	int32 Num() const { return Slots.Num(); }
+
+	// -- Private Information -- Properties -- //
+private:
+	TArray<int32> Slots;
+};
+
+/* Hands out the slot freed longest ago, a freed slot rests as long as it can before it is reused. */
+struct FProjectilePoolFifoFreeSlots
+{
+	// -- Public Information -- Strategy Traits -- //
+public:
+	static constexpr bool bPushNewSlotsInReverse = false;
+
+	// -- Public Information -- Methods -- //
+public:
+	void Reset()
+	{
+		Slots.Reset();
+		Head = 0;
+		Count = 0;
+	}
+
+	/* The ring is unwrapped into the bigger buffer, so the order is kept */
+	void Reserve(int32 InCapacity)
+	{
+		if (InCapacity <= Slots.Num()) return;
+
+		TArray<int32> NewSlots;
+		NewSlots.SetNumUninitialized(InCapacity);
+		for (int32 i = 0; i < Count; i++) NewSlots[i] = Slots[(Head + i) % Slots.Num()];
+
+		Slots = MoveTemp(NewSlots);
+		Head = 0;
+	}
+
+	/* There is always room, a pool never frees more slots than it reserved */
+	void Push(int32 InSlot)
+	{
+		check(Count < Slots.Num());
+		Slots[(Head + Count) % Slots.Num()] = InSlot;
+		Count++;
+	}
+
+	int32 Pop()
+	{
+		if (Count <= 0) return INDEX_NONE;
+
+		const int32 Slot = Slots[Head];
+		Head = (Head + 1) % Slots.Num();
+		Count--;
+		return Slot;
+	}
+
+	int32 Num() const { return Count; }
+
+	// -- Private Information -- Properties -- //
+private:
+	TArray<int32> Slots;
+	int32 Head = 0;
+	int32 Count = 0;
+};
+
+/* Hands out the lowest free slot, so the live slots stay packed at the front for in order passes. */
+struct FProjectilePoolBitsetFreeSlots
+{
+	// -- Public Information -- Strategy Traits -- //
+public:
+	static constexpr bool bPushNewSlotsInReverse = false;
+
+	// -- Public Information -- Methods -- //
+public:
+	void Reset()
+	{
+		Words.Reset();
+		Count = 0;
+		SearchWord = 0;
+	}
+
+	void Reserve(int32 InCapacity)
+	{
+		const int32 NumWords = FMath::DivideAndRoundUp(InCapacity, 32);
+		if (NumWords > Words.Num()) Words.AddZeroed(NumWords - Words.Num());
+	}
+
+	void Push(int32 InSlot)
+	{
+		Words[InSlot >> 5] |= 1u << (InSlot & 31);
+		SearchWord = FMath::Min(SearchWord, InSlot >> 5);
+		Count++;
+	}
+
+	/* Every word below the search word is empty, so the scan starts there */
+	int32 Pop()
+	{
+		if (Count <= 0) return INDEX_NONE;
+
+		for (int32 Word = SearchWord; Word < Words.Num(); Word++)
+		{
+			if (Words[Word] != 0)
+			{
+				const int32 Bit = int32(FMath::CountTrailingZeros(Words[Word]));
+				Words[Word] &= Words[Word] - 1;
+				SearchWord = Word;
+				Count--;
+				return (Word << 5) + Bit;
+			}
+		}
+
+		return INDEX_NONE;
+	}
+
+	int32 Num() const { return Count; }
+
+	// -- Private Information -- Properties -- //
+private:
+	TArray<uint32> Words;													/* One bit per slot, set while it is free */
+	int32 Count = 0;
+	int32 SearchWord = 0;
+};
+
+/*	Hands out the slot freed last like the stack, but push and pop are lock free so slots can be 
+	reserved from any thread. Reset and Reserve resize the links, whoever calls them keeps the 
+	other threads out. 
+*/
+struct FProjectilePoolLockFreeFreeSlots
+{
+	// -- Public Information -- Strategy Traits -- //
+public:
+	static constexpr bool bPushNewSlotsInReverse = true;
+
+	// -- Public Information -- Methods -- //
+public:
+	void Reset()
+	{
+		Slots.Reset();
+		Capacity = 0;
+	}
+
+	void Reserve(int32 InCapacity)
+	{
+		if (InCapacity <= Capacity) return;
+
+		Slots.SetCapacity(InCapacity);
+		Capacity = InCapacity;
+	}
+
+	void Push(int32 InSlot) { Slots.Push(InSlot); }
+
+	int32 Pop() { return Slots.Pop(); }
+
+	int32 Num() const { return Slots.Num(); }
+
+	// -- Private Information -- Properties -- //
+private:
+	FProjectileFreeSlotStack Slots;
+	int32 Capacity = 0;
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Pool Lock Policies													-
+//-----------------------------------------------------------------------------------
+/* No locking, the pool is only used from one thread. Compiles away. */
+struct FProjectilePoolNoLock
+{
+	void Lock() {}
+	void Unlock() {}
+};
+
+/* One lock around every call, the pool can be used from any thread. */
+struct FProjectilePoolMutexLock
+{
+	void Lock() { Mutex.Lock(); }
+	void Unlock() { Mutex.Unlock(); }
+
+private:
+	FCriticalSection Mutex;
+};
+
+/* Holds a pool lock for a scope. */
+template<typename TLock>
+struct TProjectilePoolScopeLock
+{
+	explicit TProjectilePoolScopeLock(TLock& InLock)
+		: ScopedLock(InLock)
+	{
+		ScopedLock.Lock();
+	}
+
+	~TProjectilePoolScopeLock()
+	{
+		ScopedLock.Unlock();
+	}
+
+	TProjectilePoolScopeLock(const TProjectilePoolScopeLock&) = delete;
+	TProjectilePoolScopeLock& operator=(const TProjectilePoolScopeLock&) = delete;
+
+private:
+	TLock& ScopedLock;
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Pool Policies															-
+//-----------------------------------------------------------------------------------
+/*	The default policy, a stack of free slots, 32 bit generations, no locking, and doubling 
+	when exhausted. Derive from it and override any of its choices, they are all read at 
+	compile time so a pool never dispatches through a virtual. 
+*/
+struct FProjectilePoolDefaultPolicy
+{
+	typedef FProjectilePoolStackFreeSlots FreeSlotsType;					/* How a free slot is chosen */
+	typedef uint32 GenerationType;											/* How wide the handle generation is, narrower wraps sooner */
+	typedef FProjectilePoolNoLock LockType;									/* How the pool is made thread safe */
+
+	static constexpr bool bGrowOnExhaustion = true;							/* Does an acquire on a full pool grow it? */
+	static constexpr bool bPoolWideGenerations = false;						/* Are generations issued from one counter instead of per slot? */
+
+	/* The capacity an exhausted pool grows to */
+	static int32 GetGrownCapacity(int32 InCapacity) { return FMath::Max(InCapacity * 2, 16); }
+};
+
+/* Reuses the slot freed longest ago. */
+struct FProjectilePoolFifoPolicy : public FProjectilePoolDefaultPolicy
+{
+	typedef FProjectilePoolFifoFreeSlots FreeSlotsType;
+};
+
+/* Reuses the lowest free slot. */
+struct FProjectilePoolBitsetPolicy : public FProjectilePoolDefaultPolicy
+{
+	typedef FProjectilePoolBitsetFreeSlots FreeSlotsType;
+};
+
+/* Locks every call, for a pool shared between threads. */
+struct FProjectilePoolThreadSafePolicy : public FProjectilePoolDefaultPolicy
+{
+	typedef FProjectilePoolMutexLock LockType;
+};
+
+/* Never grows on its own, the owner reserves the capacity it wants. */
+struct FProjectilePoolFixedPolicy : public FProjectilePoolDefaultPolicy
+{
+	static constexpr bool bGrowOnExhaustion = false;
+};
+
+/*	Free slots are reserved from any thread without a lock, everything else stays on the owning 
+	thread. Generations come from one counter, so a slot trimmed off the back and added again 
+	never repeats a handle. Never grows on its own, growth has to keep the other threads out. 
+*/
+struct FProjectilePoolLockFreePolicy : public FProjectilePoolDefaultPolicy
+{
+	typedef FProjectilePoolLockFreeFreeSlots FreeSlotsType;
+	typedef int32 GenerationType;
+
+	static constexpr bool bGrowOnExhaustion = false;
+	static constexpr bool bPoolWideGenerations = true;
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Pool Slot																-
+//-----------------------------------------------------------------------------------
+/* Where a pool slot is in its use */
+enum class EProjectilePoolSlotState : uint8
+{
+	Free,																	/* On the free list */
+	Reserved,																/* Popped, waiting to be committed */
+	Live,																	/* Handed out */
+	Empty,																	/* Off the free list with no item, until it is filled again */
+};
+
+/* The item of a pool that only tracks the slots, the owner keeps its items in a parallel array. */
+struct FProjectilePoolNoItem
+{};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Pool Handle															-
+//-----------------------------------------------------------------------------------
+/* Identifies one use of a pool slot, the slot index and the generation it was issued with. */
+template<typename TGeneration>
+struct TProjectilePoolHandle
+{
+	// -- Public Information -- Properties -- //
+public:
+	int32 Index = INDEX_NONE;
+	TGeneration Generation = 0;												/* 0 is never issued */
+
+	// -- Public Information -- Methods -- //
+public:
+	/* Was this handle ever issued? Does not mean its still alive. */
+	bool IsSet() const { return Index != INDEX_NONE && Generation != 0; }
+
+	bool operator==(const TProjectilePoolHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+
+	bool operator!=(const TProjectilePoolHandle& Other) const { return !(*this == Other); }
+
+public:
+	TProjectilePoolHandle()
+	{}
+
+	explicit TProjectilePoolHandle(int32 InIndex, TGeneration InGeneration)
+		: Index(InIndex)
+		, Generation(InGeneration)
+	{}
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Pool																	-
+//-----------------------------------------------------------------------------------
+/*	A pool of items in stable slots, handed out through generational handles. The slots never 
+	move, a released slot bumps its generation so every handle to the old use goes stale. How 
+	a free slot is picked, the generation width, the locking and the growth all come from the 
+	policy at compile time. Only needs Core, nothing about actors or the engine. 
+
+	Pointers from Resolve or GetItemAt are good until the pool grows, and with a thread safe 
+	policy only the calls are locked, not what the caller does with the item after. 
+
+	An acquire can also be split in two, ReserveSlot pops a slot and CommitSlot hands it out. 
+	With a lock free policy the reserve is safe from any thread, the rest is left to the owner, 
+	which can still read the slot states and generations while a reserve writes them. 
+	Slots can be emptied and filled one at a time so an owner can shrink without moving any. 
+*/
+template<typename TItem, typename TPolicy = FProjectilePoolDefaultPolicy>
+class TProjectilePool
+{
+	// -- Public Information -- Types -- //
+public:
+	typedef typename TPolicy::GenerationType GenerationType;
+	typedef TProjectilePoolHandle<GenerationType> FHandle;
+
+	// -- Public Information -- Constructor -- //
+public:
+	TProjectilePool()
+	{}
+
+	explicit TProjectilePool(int32 InCapacity)
+	{
+		Reserve(InCapacity);
+	}
+
+	// -- Public Information -- Methods -- //
+public:
+	/* Frees every slot and drops the storage, every handle goes stale */
+	void Reset()
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		Slots.Reset();
+		FreeSlots.Reset();
+		NumLive = 0;
+		NumEmpty = 0;
+	}
+
+	/* Grows to at least the capacity, live slots keep their index */
+	void Reserve(int32 InCapacity)
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		Grow_Locked(InCapacity);
+	}
+
+	/* Puts the item in a free slot, an unset handle if the pool is full and cant grow */
+	FHandle Acquire(TItem InItem)
+	{
+		FPoolScopeLock ScopeLock(Lock);
+
+		int32 Index = FreeSlots.Pop();
+		if (Index == INDEX_NONE && TPolicy::bGrowOnExhaustion)
+		{
+			Grow_Locked(TPolicy::GetGrownCapacity(Slots.Num()));
+			Index = FreeSlots.Pop();
+		}
+
+		if (Index == INDEX_NONE) return FHandle();
+
+		FSlot& Slot = Slots[Index];
+		Slot.Item = MoveTemp(InItem);
+		const FHandle Handle(Index, IssueGeneration(Slot));
+		StoreState(Slot, EProjectilePoolSlotState::Live);
+		NumLive++;
+
+		return Handle;
+	}
+
+	/* Pops a free slot and holds it until it is committed, never grows. An unset handle if there is none */
+	FHandle ReserveSlot()
+	{
+		FPoolScopeLock ScopeLock(Lock);
+
+		const int32 Index = FreeSlots.Pop();
+		if (Index == INDEX_NONE) return FHandle();
+
+		// the popped slot belongs to the caller alone until it is committed, the generation is 
+		// stored before the state so whoever sees it reserved sees the generation with it. 
+		FSlot& Slot = Slots[Index];
+		const FHandle Handle(Index, IssueGeneration(Slot));
+		StoreState(Slot, EProjectilePoolSlotState::Reserved);
+		return Handle;
+	}
+
+	/* Puts the item in a reserved slot and hands it out, an unset handle if the slot is not reserved */
+	FHandle CommitSlot(int32 InIndex, TItem InItem = TItem())
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		if (!Slots.IsValidIndex(InIndex) || LoadState(Slots[InIndex]) != EProjectilePoolSlotState::Reserved) return FHandle();
+
+		FSlot& Slot = Slots[InIndex];
+		Slot.Item = MoveTemp(InItem);
+		StoreState(Slot, EProjectilePoolSlotState::Live);
+		NumLive++;
+
+		return FHandle(InIndex, LoadGeneration(Slot));
+	}
+
+	/* Commits a reservation by its handle, false if the slot was emptied or reset since it was reserved */
+	bool CommitReservation(const FHandle& InHandle, TItem InItem = TItem())
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		if (!IsReservedFor_Locked(InHandle)) return false;
+
+		FSlot& Slot = Slots[InHandle.Index];
+		Slot.Item = MoveTemp(InItem);
+		StoreState(Slot, EProjectilePoolSlotState::Live);
+		NumLive++;
+		return true;
+	}
+
+	/* Frees the slot of a live handle, false for stale or double releases */
+	bool Release(const FHandle& InHandle)
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		if (!IsAlive_Locked(InHandle)) return false;
+
+		Release_Locked(InHandle.Index);
+		return true;
+	}
+
+	/* Frees a live slot by its index */
+	bool ReleaseAt(int32 InIndex)
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		if (!Slots.IsValidIndex(InIndex) || LoadState(Slots[InIndex]) != EProjectilePoolSlotState::Live) return false;
+
+		Release_Locked(InIndex);
+		return true;
+	}
+
+	/* Appends one free slot, for owners that add their items one at a time. Returns its index */
+	int32 AddFreeSlot()
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		Grow_Locked(Slots.Num() + 1);
+		return Slots.Num() - 1;
+	}
+
+	/* Frees an empty slot again, its generation carries on from its last use */
+	bool FillEmptySlot(int32 InIndex)
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		if (!Slots.IsValidIndex(InIndex) || LoadState(Slots[InIndex]) != EProjectilePoolSlotState::Empty) return false;
+
+		StoreState(Slots[InIndex], EProjectilePoolSlotState::Free);
+		FreeSlots.Push(InIndex);
+		NumEmpty--;
+		return true;
+	}
+
+	/*	Empties a slot, a live one goes stale. A free one is left on the free list, the caller 
+		clears or rebuilds the free list around emptying free slots. 
+	*/
+	void EmptySlot(int32 InIndex)
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		if (!Slots.IsValidIndex(InIndex) || LoadState(Slots[InIndex]) == EProjectilePoolSlotState::Empty) return;
+
+		FSlot& Slot = Slots[InIndex];
+		if (LoadState(Slot) == EProjectilePoolSlotState::Live) NumLive--;
+
+		Slot.Item = TItem();
+		StoreState(Slot, EProjectilePoolSlotState::Empty);
+		Bump_Generation(Slot);
+		NumEmpty++;
+	}
+
+	/* Drops the empty slots at the back, every other slot keeps its index. Returns the number dropped */
+	int32 TrimTrailingEmptySlots()
+	{
+		FPoolScopeLock ScopeLock(Lock);
+
+		int32 NewNum = Slots.Num();
+		while (NewNum > 0 && LoadState(Slots[NewNum - 1]) == EProjectilePoolSlotState::Empty) NewNum--;
+
+		const int32 NumTrimmed = Slots.Num() - NewNum;
+		Slots.SetNum(NewNum, false);
+		NumEmpty -= NumTrimmed;
+		return NumTrimmed;
+	}
+
+	/* Takes every slot off the free list, they stay free but can no longer be reserved */
+	void ClearFreeSlots()
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		FreeSlots.Reset();
+		FreeSlots.Reserve(Slots.Num());
+	}
+
+	/* Puts every free slot back on the free list in a single pass, after free slots were emptied */
+	void RebuildFreeSlots()
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		FreeSlots.Reset();
+		FreeSlots.Reserve(Slots.Num());
+
+		if (TPolicy::FreeSlotsType::bPushNewSlotsInReverse)
+		{
+			for (int32 i = Slots.Num() - 1; i >= 0; i--) if (LoadState(Slots[i]) == EProjectilePoolSlotState::Free) FreeSlots.Push(i);
+		}
+		else
+		{
+			for (int32 i = 0; i < Slots.Num(); i++) if (LoadState(Slots[i]) == EProjectilePoolSlotState::Free) FreeSlots.Push(i);
+		}
+	}
+
+	/* The item of a live handle, null if the handle is stale */
+	TItem* Resolve(const FHandle& InHandle)
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		return IsAlive_Locked(InHandle) ? &Slots[InHandle.Index].Item : nullptr;
+	}
+
+	const TItem* Resolve(const FHandle& InHandle) const
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		return IsAlive_Locked(InHandle) ? &Slots[InHandle.Index].Item : nullptr;
+	}
+
+	/* Is the handle the current use of its slot? */
+	bool IsAlive(const FHandle& InHandle) const
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		return IsAlive_Locked(InHandle);
+	}
+
+	/* Is the handle the reservation still waiting on its slot? */
+	bool IsReservedFor(const FHandle& InHandle) const
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		return IsReservedFor_Locked(InHandle);
+	}
+
+	/* The handle of the current use of a live slot, unset if the slot is free */
+	FHandle GetHandleAt(int32 InIndex) const
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		return Slots.IsValidIndex(InIndex) && LoadState(Slots[InIndex]) == EProjectilePoolSlotState::Live ? FHandle(InIndex, LoadGeneration(Slots[InIndex])) : FHandle();
+	}
+
+	/* Where a slot is in its use, the index must be a slot */
+	EProjectilePoolSlotState GetStateAt(int32 InIndex) const { return LoadState(Slots[InIndex]); }
+
+	/* The generation of the current or last use of a slot, the index must be a slot */
+	GenerationType GetGenerationAt(int32 InIndex) const { return LoadGeneration(Slots[InIndex]); }
+
+	/* The item in a slot, the index must be a live slot */
+	TItem& GetItemAt(int32 InIndex) { return Slots[InIndex].Item; }
+
+	const TItem& GetItemAt(int32 InIndex) const { return Slots[InIndex].Item; }
+
+	/* Calls the function with the handle and item of every live slot, in slot order */
+	template<typename FuncType>
+	void ForEachLive(FuncType&& InFunc)
+	{
+		FPoolScopeLock ScopeLock(Lock);
+		for (int32 i = 0; i < Slots.Num(); i++)
+		{
+			if (LoadState(Slots[i]) == EProjectilePoolSlotState::Live) InFunc(FHandle(i, LoadGeneration(Slots[i])), Slots[i].Item);
+		}
+	}
+
+	/* The number of live slots */
+	int32 Num() const { return NumLive; }
+
+	/* The number of slots, live or free */
+	int32 GetCapacity() const { return Slots.Num(); }
+
+	/* The number of slots on the free list */
+	int32 NumFree() const { return FreeSlots.Num(); }
+
+	/* The number of empty slots */
+	int32 GetNumEmpty() const { return NumEmpty; }
+
+	// -- Private Information -- Types -- //
+private:
+	typedef TProjectilePoolScopeLock<typename TPolicy::LockType> FPoolScopeLock;
+
+	static_assert(sizeof(GenerationType) <= sizeof(int32), "A pool generation is stored in 32 bits");
+
+	/*	A reserve can write the state and generation of a slot from another thread while the owner 
+		reads them, so both are only touched through the atomics. 
+	*/
+	struct FSlot
+	{
+		TItem Item = TItem();
+		volatile int32 Generation = 1;										/* The GenerationType the next or current use is issued with */
+		volatile int32 State = int32(EProjectilePoolSlotState::Free);		/* The EProjectilePoolSlotState */
+	};
+
+	// -- Private Information -- Methods -- //
+private:
+	static EProjectilePoolSlotState LoadState(const FSlot& InSlot) { return EProjectilePoolSlotState(FPlatformAtomics::AtomicRead(&InSlot.State)); }
+
+	static void StoreState(FSlot& InSlot, EProjectilePoolSlotState InState) { FPlatformAtomics::AtomicStore(&InSlot.State, int32(InState)); }
+
+	static GenerationType LoadGeneration(const FSlot& InSlot) { return GenerationType(FPlatformAtomics::AtomicRead(&InSlot.Generation)); }
+
+	static void StoreGeneration(FSlot& InSlot, GenerationType InGeneration) { FPlatformAtomics::AtomicStore(&InSlot.Generation, int32(InGeneration)); }
+
+	bool IsAlive_Locked(const FHandle& InHandle) const
+	{
+		return InHandle.IsSet() && Slots.IsValidIndex(InHandle.Index) && LoadState(Slots[InHandle.Index]) == EProjectilePoolSlotState::Live && LoadGeneration(Slots[InHandle.Index]) == InHandle.Generation;
+	}
+
+	bool IsReservedFor_Locked(const FHandle& InHandle) const
+	{
+		return InHandle.IsSet() && Slots.IsValidIndex(InHandle.Index) && LoadState(Slots[InHandle.Index]) == EProjectilePoolSlotState::Reserved && LoadGeneration(Slots[InHandle.Index]) == InHandle.Generation;
+	}
+
+	/*	The generation of a use being handed out. A per slot generation was already moved on by 
+		the last release, a pool wide one is taken from the counter, any thread, skipping 0 on wrap. 
+	*/
+	GenerationType IssueGeneration(FSlot& InSlot)
+	{
+		if (!TPolicy::bPoolWideGenerations) return LoadGeneration(InSlot);
+
+		const int64 MaxGeneration = FMath::Min<int64>(MAX_int32, int64(TNumericLimits<GenerationType>::Max()));
+		int32 Issued = FPlatformAtomics::AtomicRead(&NextGeneration);
+
+		for (;;)
+		{
+			const int32 Next = Issued >= MaxGeneration ? 1 : Issued + 1;
+			const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(&NextGeneration, Next, Issued);
+			if (Previous == Issued) break;
+
+			Issued = Previous;
+		}
+
+		StoreGeneration(InSlot, GenerationType(Issued));
+		return GenerationType(Issued);
+	}
+
+	/* Moves a per slot generation on so every handle to the last use goes stale, never landing on 0 */
+	static void Bump_Generation(FSlot& InSlot)
+	{
+		if (TPolicy::bPoolWideGenerations) return;
+
+		GenerationType Generation = GenerationType(LoadGeneration(InSlot) + 1);
+		if (Generation == 0) Generation = 1;
+		StoreGeneration(InSlot, Generation);
+	}
+
+	/* Adds free slots up to the capacity */
+	void Grow_Locked(int32 InCapacity)
+	{
+		const int32 OldCapacity = Slots.Num();
+		if (InCapacity <= OldCapacity) return;
+
+		Slots.AddDefaulted(InCapacity - OldCapacity);
+
+		// sized to the slack of the slots, so adding one slot at a time only regrows with them. 
+		FreeSlots.Reserve(Slots.Max());
+
+		if (TPolicy::FreeSlotsType::bPushNewSlotsInReverse)
+		{
+			for (int32 i = InCapacity - 1; i >= OldCapacity; i--) FreeSlots.Push(i);
+		}
+		else
+		{
+			for (int32 i = OldCapacity; i < InCapacity; i++) FreeSlots.Push(i);
+		}
+	}
+
+	/* Frees a live slot, its generation moves on */
+	void Release_Locked(int32 InIndex)
+	{
+		FSlot& Slot = Slots[InIndex];
+		Slot.Item = TItem();
+		StoreState(Slot, EProjectilePoolSlotState::Free);
+		Bump_Generation(Slot);
+
+		FreeSlots.Push(InIndex);
+		NumLive--;
+	}
+
+	// -- Private Information -- Properties -- //
+private:
+	TArray<FSlot> Slots;
+	typename TPolicy::FreeSlotsType FreeSlots;
+	int32 NumLive = 0;
+	int32 NumEmpty = 0;
+	volatile int32 NextGeneration = 1;										/* Only used with pool wide generations */
+	mutable typename TPolicy::LockType Lock;
+};
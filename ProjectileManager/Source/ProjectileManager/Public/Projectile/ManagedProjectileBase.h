@@ -1,178 +1,354 @@
-/*	Copyright / License  Disclaimer
-*	MIT Copyright 2020 Nicholas Mallonee
-*	Permission is hereby granted, free of charge, to any person obtaining a
-*	copy of this software and associated documentation files(the "Software"), to deal
-*	in the Software without restriction, including without limitation the rights to use,
-*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
-*	Software, and to permit persons to whom the Software is furnished to do so, subject
-*	to the following conditions :
-*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
-*
-*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
-*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
-*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
-*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
-*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
-*	OTHER DEALINGS IN THE SOFTWARE.
-*/
-#pragma once
-
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "Components/SphereComponent.h"
-#include "Runtime/Engine/Classes/GameFramework/ProjectileMovementComponent.h"
-#include "ManagedProjectileBase.generated.h"
-
-//-----------------------------------------------------------------------------------
-// Managed Projectile Base Class Structs											-
-//-----------------------------------------------------------------------------------
-/* Struct that Defines the pull or putting back into the pool. */
-USTRUCT(BlueprintType)
-struct FProjectilePoolRequest
-{
-	GENERATED_BODY()
-
-	// -- Public Information -- Struct Properties -- 
-public:
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
-	bool bTeleportOnMove = true;												// teleport or sweep when pulling or putting it back? 
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
-	bool bHideAfterPoolRequest = false;											// should the actor be visible after moving.
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
-	bool bEnableTick = true;													// should the tick function on the projectile be enabled after the operation?
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
-	TEnumAsByte<ECollisionEnabled::Type> CollisionSettings = ECollisionEnabled::NoCollision;	// what do we want the collision to be set to on pull from pool or back into pool
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
-	float ProjectileSpeed = 0.f;												// the speed of the projectile movement? 
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
-	FVector LocationToMoveTo = FVector::ZeroVector;								// the location to move the projectile to?
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
-	FVector DirectionUnitVector = FVector::ForwardVector;						// the direction we want the projectile to be facing. 
-
-	// -- Public Information -- Struct Methods -- //
-public:
-	/* Teleport On move */
-	bool GetTeleportOnMove() const { return bTeleportOnMove; }
-
-	/* Do we want to hide the actor after the move? */
-	bool GetHideAfterPoolRequest() const { return bHideAfterPoolRequest; }
-
-	bool GetEnableTick() const { return bEnableTick; }
-	
-	/* Get the collision enabled flag? */
-	ECollisionEnabled::Type GetCollisionEnabledSettings() const { return CollisionSettings; }
-
-	/* Get the projectile speed */
-	float GetProjectileSpeed() const { return ProjectileSpeed; }
-
-	/* Get the projectile start locaiton */
-	FVector GetStartLocation() const { return LocationToMoveTo; }
-
-	/* Get the direction vector */
-	FVector GetDirectionVector() const { return DirectionUnitVector; }
-
-public:
-	FProjectilePoolRequest()
-	{}
-
-	explicit struct FProjectilePoolRequest(bool bTeleport, bool bOnHideOnRequest, ECollisionEnabled::Type CollSettings, float Speed, FVector Loc, FVector Unit)
-	{
-		bTeleportOnMove = bTeleport;
-		bHideAfterPoolRequest = bOnHideOnRequest;
-		CollisionSettings = CollSettings;
-		ProjectileSpeed = Speed;
-		LocationToMoveTo = Loc;
-		DirectionUnitVector = Unit;
-	}
-};
-
-/* Struct that helps define inforation for inside out information gathering. */
-USTRUCT()
-struct FProjectilePoolInformation
-{
-	GENERATED_BODY()
-
-	// -- Public Information -- Struct Properties -- 
-public:
-	UPROPERTY()
-	int32 LastKnownEntryInPool = 0;
-
-	UPROPERTY()
-	uint32 HashedPointerToManager = 0x0000;
-
-	// -- Public Information -- Struct Methods -- 
-public:
-	int32 GetLastKnownEntry() const { return LastKnownEntryInPool; }
-
-	uint32 GetHashedPointer() const { return HashedPointerToManager; }
-
-	void UpdateLastKnownEntry(int32& Entry)
-	{
-		LastKnownEntryInPool = Entry;
-	}
-
-	void UpdateHashedPointer(uint32& ptr)
-	{
-		HashedPointerToManager = ptr;
-	}
-
-public:
-	FProjectilePoolInformation()
-	{}
-};
-
-
-//-----------------------------------------------------------------------------------
-// Managed Projectile Base Class Declariation										-
-//-----------------------------------------------------------------------------------
-UCLASS()
-class PROJECTILEMANAGER_API AManagedProjectileBase : public AActor
-{
-	GENERATED_BODY()
-	
-	// -- Public Information -- Managed Projectile Constructor and Engine Events -- //
-public:	
-	AManagedProjectileBase();
-
-	virtual void BeginPlay() override;
-
-	virtual void Tick(float DeltaTime) override;
-
-	// -- Public Information -- Projectile Life Cycle Methods -- //
-public:
-	UFUNCTION(BlueprintCallable, Category = "Managed Projectile | Lifecycle ")
-	bool Request_UpdateFromPool(FProjectilePoolRequest Settings);
-
-	UFUNCTION(BlueprintCallable, Category = "Managed Projectile | Lifecycle ")
-	bool Deinit_ProjectileBase();
-
-	UFUNCTION(BlueprintCallable, Category = "Managed Projectile | Optimization ")
-	bool Requst_TickMoveToAsync(bool bNewState);
-
-	// -- Public Information -- Projectile Optimizations -- //
-public:
-	int32 GetLastKnownEntryInPool() const { return PoolInformation.GetLastKnownEntry(); }
-
-	/* Updates the last known entry */
-	void UpdateLastKnownEntryInPool(int32& Index)
-	{
-		PoolInformation.UpdateLastKnownEntry(Index);
-	}
-
-	// -- Public Information -- Class Properties -- //
-public:
-	UPROPERTY()
-	FProjectilePoolInformation PoolInformation; 
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Properties | Projectile Components")
-	USphereComponent* SphereCollision = nullptr;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Properties | Projectile Components")
-	UProjectileMovementComponent* ProjectileMovement = nullptr;
-};
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Components/SphereComponent.h"
+#include "Runtime/Engine/Classes/GameFramework/ProjectileMovementComponent.h"
+#include "ManagedProjectileBase.generated.h"
+
+//-----------------------------------------------------------------------------------
+// Managed Projectile Base Class Structs											-
+//-----------------------------------------------------------------------------------
+/* Struct that Defines the pull or putting back into the pool. */
+USTRUCT(BlueprintType)
+struct FProjectilePoolRequest
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Struct Properties -- 
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
+	bool bTeleportOnMove = true;												// teleport or sweep when pulling or putting it back? 
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
+	bool bHideAfterPoolRequest = false;											// should the actor be visible after moving.
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
+	bool bEnableTick = true;													// should the tick function on the projectile be enabled after the operation?
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
+	TEnumAsByte<ECollisionEnabled::Type> CollisionSettings = ECollisionEnabled::NoCollision;	// what do we want the collision to be set to on pull from pool or back into pool
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
+	float ProjectileSpeed = 0.f;												// the speed of the projectile movement? 
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
+	FVector LocationToMoveTo = FVector::ZeroVector;								// the location to move the projectile to?
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
+	FVector DirectionUnitVector = FVector::ForwardVector;						// the direction we want the projectile to be facing. 
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings")
+	AActor* OwningActor = nullptr;												// the actor that fired the projectile, if any.
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings", meta = (ClampMin = "0.0"))
+	float MaxLifetime = 0.f;													// seconds until the manager returns the projectile, 0 never expires.
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Pool Request Settings", meta = (ClampMin = "0.0"))
+	float MaxTravelDistance = 0.f;												// distance from the start location the manager returns the projectile at, 0 has no limit.
+
+	// -- Public Information -- Struct Methods -- //
+public:
+	/* Teleport On move */
+	bool GetTeleportOnMove() const { return bTeleportOnMove; }
+
+	/* Do we want to hide the actor after the move? */
+	bool GetHideAfterPoolRequest() const { return bHideAfterPoolRequest; }
+
+	bool GetEnableTick() const { return bEnableTick; }
+	
+	/* Get the collision enabled flag? */
+	ECollisionEnabled::Type GetCollisionEnabledSettings() const { return CollisionSettings; }
+
+	/* Get the projectile speed */
+	float GetProjectileSpeed() const { return ProjectileSpeed; }
+
+	/* Get the projectile start locaiton */
+	FVector GetStartLocation() const { return LocationToMoveTo; }
+
+	/* Get the direction vector */
+	FVector GetDirectionVector() const { return DirectionUnitVector; }
+
+	/* Get the actor that fired the projectile */
+	AActor* GetOwningActor() const { return OwningActor; }
+
+	/* Get the lifetime */
+	float GetMaxLifetime() const { return MaxLifetime; }
+
+	/* Get the travel limit */
+	float GetMaxTravelDistance() const { return MaxTravelDistance; }
+
+	/* Does the manager have to expire the projectile? */
+	bool HasExpiry() const { return MaxLifetime > 0.f || MaxTravelDistance > 0.f; }
+
+public:
+	FProjectilePoolRequest()
+	{}
+
+	explicit struct FProjectilePoolRequest(bool bTeleport, bool bOnHideOnRequest, ECollisionEnabled::Type CollSettings, float Speed, FVector Loc, FVector Unit)
+	{
+		bTeleportOnMove = bTeleport;
+		bHideAfterPoolRequest = bOnHideOnRequest;
+		CollisionSettings = CollSettings;
+		ProjectileSpeed = Speed;
+		LocationToMoveTo = Loc;
+		DirectionUnitVector = Unit;
+	}
+};
+
+/* Struct that identifies a single use of a pooled projectile, slot index + the generation it was issued with. */
+USTRUCT(BlueprintType)
+struct FProjectileHandle
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Struct Properties -- 
+public:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Projectile Handle")
+	int32 SlotIndex = INDEX_NONE;												// the slot in the managed pool this handle points at.
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Projectile Handle")
+	int32 Generation = 0;														// the generation the slot had when this handle was issued, 0 is never issued.
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Projectile Handle")
+	int32 PoolIndex = 0;														// the sub pool the slot is in, the class id of the projectile.
+
+	// -- Public Information -- Struct Methods -- 
+public:
+	/* Get the slot index */
+	int32 GetSlotIndex() const { return SlotIndex; }
+
+	/* Get the generation */
+	int32 GetGeneration() const { return Generation; }
+
+	/* Get the sub pool index */
+	int32 GetPoolIndex() const { return PoolIndex; }
+
+	/* Was this handle ever issued? Does not mean its still alive. */
+	bool IsSet() const { return SlotIndex != INDEX_NONE && Generation != 0; }
+
+	/* Clears the handle back to the unset state */
+	void Reset()
+	{
+		SlotIndex = INDEX_NONE;
+		Generation = 0;
+		PoolIndex = 0;
+	}
+
+	bool operator==(const FProjectileHandle& Other) const { return SlotIndex == Other.SlotIndex && Generation == Other.Generation && PoolIndex == Other.PoolIndex; }
+
+	bool operator!=(const FProjectileHandle& Other) const { return !(*this == Other); }
+
+public:
+	FProjectileHandle()
+	{}
+
+	explicit FProjectileHandle(int32 InSlotIndex, int32 InGeneration, int32 InPoolIndex = 0)
+	{
+		SlotIndex = InSlotIndex;
+		Generation = InGeneration;
+		PoolIndex = InPoolIndex;
+	}
+};
+
+/* Struct that helps define inforation for inside out information gathering. */
+USTRUCT()
+struct FProjectilePoolInformation
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Struct Properties -- 
+public:
+	UPROPERTY()
+	FProjectileHandle PoolHandle;
+
+	UPROPERTY()
+	uint32 HashedPointerToManager = 0x0000;
+
+	// -- Public Information -- Struct Methods -- 
+public:
+	const FProjectileHandle& GetPoolHandle() const { return PoolHandle; }
+
+	uint32 GetHashedPointer() const { return HashedPointerToManager; }
+
+	void UpdatePoolHandle(const FProjectileHandle& Handle)
+	{
+		PoolHandle = Handle;
+	}
+
+	void UpdateHashedPointer(uint32& ptr)
+	{
+		HashedPointerToManager = ptr;
+	}
+
+public:
+	FProjectilePoolInformation()
+	{}
+};
+
+
+/* Struct that remembers the pool state last applied to a projectile, so unchanged state is not set again. */
+USTRUCT()
+struct FProjectileAppliedPoolState
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Struct Properties -- 
+public:
+	UPROPERTY()
+	bool bIsValid = false;														// has a pool request been applied since the state was last unknown?
+
+	UPROPERTY()
+	bool bTickEnabled = false;
+
+	UPROPERTY()
+	bool bHidden = false;
+
+	UPROPERTY()
+	TEnumAsByte<ECollisionEnabled::Type> CollisionSettings = ECollisionEnabled::NoCollision;
+
+	// -- Public Information -- Struct Methods -- 
+public:
+	/* Does the collision have to be set for this request? */
+	bool NeedsCollision(ECollisionEnabled::Type InSettings) const { return !bIsValid || CollisionSettings != InSettings; }
+
+	/* Does the tick have to be set for this request? */
+	bool NeedsTick(bool bInEnabled) const { return !bIsValid || bTickEnabled != bInEnabled; }
+
+	/* Does the visibility have to be set for this request? */
+	bool NeedsHidden(bool bInHidden) const { return !bIsValid || bHidden != bInHidden; }
+
+	/* Forgets the applied state, the next request sets everything again */
+	void Invalidate() { bIsValid = false; }
+
+public:
+	FProjectileAppliedPoolState()
+	{}
+};
+
+#if WITH_DEV_AUTOMATION_TESTS
+/* The pool state setters every projectile has called, only counted for the benchmark. Game thread only. */
+struct PROJECTILEMANAGER_API FProjectilePoolStateSetCounts
+{
+	static int32 NumCollisionSets;												// times a pool request set the collision, each one can recreate the physics state.
+	static int32 NumTickSets;
+	static int32 NumHiddenSets;													// times a pool request set the visibility, each one can dirty the render state.
+};
+#endif
+
+//-----------------------------------------------------------------------------------
+// Managed Projectile Base Class Declariation										-
+//-----------------------------------------------------------------------------------
+UCLASS()
+class PROJECTILEMANAGER_API AManagedProjectileBase : public AActor
+{
+	GENERATED_BODY()
+	
+	// -- Public Information -- Managed Projectile Constructor and Engine Events -- //
+public:	
+	AManagedProjectileBase();
+
+	virtual void BeginPlay() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	// -- Public Information -- Projectile Life Cycle Methods -- //
+public:
+	UFUNCTION(BlueprintCallable, Category = "Managed Projectile | Lifecycle ")
+	bool Request_UpdateFromPool(const FProjectilePoolRequest& Settings);
+
+	UFUNCTION(BlueprintCallable, Category = "Managed Projectile | Lifecycle ")
+	bool Deinit_ProjectileBase();
+
+	UFUNCTION(BlueprintCallable, Category = "Managed Projectile | Optimization ")
+	bool Requst_TickMoveToAsync(bool bNewState);
+
+	// -- Public Information -- Projectile Optimizations -- //
+public:
+	/* The handle this projectile was last issued with by the manager. */
+	UFUNCTION(BlueprintPure, Category = "Managed Projectile | Pool ")
+	FProjectileHandle GetPoolHandle() const { return PoolInformation.GetPoolHandle(); }
+
+	/* Updates the pool handle */
+	void UpdatePoolHandle(const FProjectileHandle& Handle)
+	{
+		PoolInformation.UpdatePoolHandle(Handle);
+	}
+
+	/* Is the manager ticking this projectile instead of its own tick functions? */
+	bool IsTickedByManager() const { return bTickedByManager; }
+
+	/* Hands the tick over to the manager, the actor and movement ticks stay off while it does. */
+	void SetTickedByManager(bool bNewState);
+
+	/* The manager batched update, only steps the movement. Not virtual, the actor tick is never called. Returns if it stepped. */
+	bool Tick_Batched(float DeltaTime);
+
+	/* Sets the seconds between movement steps, 0 steps every frame. */
+	void SetSimulationStepInterval(float InInterval);
+
+	/* Gets the seconds between movement steps */
+	float GetSimulationStepInterval() const { return SimulationStepInterval; }
+
+	/* Is the projectile parked with its components unregistered? */
+	bool IsParked() const { return bIsParked; }
+
+	/* Unregisters the components while the projectile sits in the pool, no physics body, scene proxy or tick is left. */
+	void Request_Park();
+
+	/* Registers the parked components again, at the transform and with the settings the last pool request gave them. */
+	void Request_Unpark();
+
+	/* Call after changing the collision, tick or visibility outside a pool request, the next request sets them all again. */
+	UFUNCTION(BlueprintCallable, Category = "Managed Projectile | Pool ")
+	void InvalidateAppliedPoolState() { AppliedPoolState.Invalidate(); }
+
+	// -- Public Information -- Class Properties -- //
+public:
+	UPROPERTY()
+	FProjectilePoolInformation PoolInformation; 
+
+	UPROPERTY()
+	bool bTickedByManager = false;							// the manager batches the tick, the actor and movement ticks are off.
+
+	UPROPERTY()
+	bool bBatchTickEnabled = false;							// the last pool request asked for the tick, only used while ticked by the manager.
+
+	UPROPERTY()
+	float SimulationStepInterval = 0.f;						// the seconds between movement steps set by the managers significance pass, 0 is every frame.
+
+	UPROPERTY()
+	float BatchStepPendingTime = 0.f;						// the frame time saved up for the next batched step.
+
+	UPROPERTY()
+	FProjectileAppliedPoolState AppliedPoolState;			// the collision, tick and visibility the last pool request applied.
+
+	UPROPERTY()
+	bool bIsParked = false;									// the components are unregistered while the projectile is in the pool.
+
+	UPROPERTY(Transient)
+	TArray<UActorComponent*> ParkedComponents;				// the components parking unregistered, the root first so it registers first.
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Properties | Projectile Components")
+	USphereComponent* SphereCollision = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Properties | Projectile Components")
+	UProjectileMovementComponent* ProjectileMovement = nullptr;
+};
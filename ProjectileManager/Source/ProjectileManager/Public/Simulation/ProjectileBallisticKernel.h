@@ -0,0 +1,74 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProjectileManager/Public/Simulation/ProjectileSimulationData.h"
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Ballistic Kernel Structs												-
+//-----------------------------------------------------------------------------------
+/* The per step constants the ballistic kernel integrates with */
+struct FProjectileBallisticParams
+{
+	// -- Public Information -- Properties -- //
+public:
+	FVector Gravity = FVector::ZeroVector;				/* Acceleration applied every step, world units per second squared */
+
+	float LinearDrag = 0.f;								/* Fraction of the velocity lost per second */
+
+	float MaxSpeed = 0.f;								/* Speed the velocity is clamped to, 0 is unlimited */
+
+public:
+	FProjectileBallisticParams()
+	{}
+
+	explicit FProjectileBallisticParams(const FVector& InGravity, float InLinearDrag, float InMaxSpeed)
+	{
+		Gravity = InGravity;
+		LinearDrag = InLinearDrag;
+		MaxSpeed = InMaxSpeed;
+	}
+};
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Ballistic Kernel Declariation											-
+//-----------------------------------------------------------------------------------
+/*	Bulk ballistic integration over a range of the simulation data. 
+	Both paths apply gravity, then linear drag, then the max speed clamp, then move the 
+	position by the new velocity. The scalar path is the reference the vectorized path must 
+	match, and handles the tail of any range that is not a multiple of four. 
+*/
+struct PROJECTILEMANAGER_API FProjectileBallisticKernel
+{
+	// -- Public Information -- Kernel Methods -- //
+public:
+	/* Integrates one projectile at a time */
+	static void Integrate_Scalar(FProjectileSimulationData& Data, int32 StartIndex, int32 Count, float DeltaTime, const FProjectileBallisticParams& Params);
+
+	/* Integrates four projectiles per vector instruction */
+	static void Integrate_Vectorized(FProjectileSimulationData& Data, int32 StartIndex, int32 Count, float DeltaTime, const FProjectileBallisticParams& Params);
+
+	/* Writes the orientation facing along the velocity, one projectile at a time */
+	static void ComputeOrientations_Scalar(FProjectileSimulationData& Data, int32 StartIndex, int32 Count);
+
+	/* Writes the orientation facing along the velocity, four projectiles per vector instruction */
+	static void ComputeOrientations_Vectorized(FProjectileSimulationData& Data, int32 StartIndex, int32 Count);
+};
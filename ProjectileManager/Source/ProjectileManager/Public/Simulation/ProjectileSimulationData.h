@@ -0,0 +1,179 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProjectileManager/Public/Projectile/ManagedProjectileBase.h"
+#include "ProjectileManager/Public/Pool/ProjectilePool.h"
+#include "ProjectileSimulationData.generated.h"
+
+
+/* The slot side of the simulation data, each live slot holds its dense index */
+typedef TProjectilePool<int32, FProjectilePoolFixedPolicy> FProjectileSimulationSlotPool;
+
+//-----------------------------------------------------------------------------------
+// Projectile Simulation Data Flags													-
+//-----------------------------------------------------------------------------------
+/* Per projectile flags stored in the simulation data */
+namespace EProjectileSimulationFlags
+{
+	enum Type : uint8
+	{
+		None				= 0,
+		CollisionEnabled	= 1 << 0,		/* The projectile wants to collide */
+		Hidden				= 1 << 1,		/* The projectile should not be drawn */
+	};
+}
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Simulation Data Struct												-
+//-----------------------------------------------------------------------------------
+/*	Structure of arrays storage for actorless projectiles. 
+	The live projectiles are packed into the front of the dense arrays so the simulation only 
+	ever walks contiguous memory. Handles point at a slot, the slot maps to the dense index, 
+	so removing a projectile is a swap with the last live one. Positions and velocities are 
+	split per axis so the kernel can load four projectiles into one vector register. 
+*/
+USTRUCT()
+struct PROJECTILEMANAGER_API FProjectileSimulationData
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Dense Properties, [0, Num()) are live -- //
+public:
+	UPROPERTY()
+	TArray<float> PositionsX;
+
+	UPROPERTY()
+	TArray<float> PositionsY;
+
+	UPROPERTY()
+	TArray<float> PositionsZ;
+
+	UPROPERTY()
+	TArray<float> VelocitiesX;
+
+	UPROPERTY()
+	TArray<float> VelocitiesY;
+
+	UPROPERTY()
+	TArray<float> VelocitiesZ;
+
+	UPROPERTY()
+	TArray<FQuat> Orientations;														/* Only kept up to date when rotation follows velocity */
+
+	UPROPERTY()
+	TArray<float> Ages;																/* Seconds since the projectile was fired */
+
+	UPROPERTY()
+	TArray<float> CollisionRadii;
+
+	UPROPERTY()
+	TArray<TWeakObjectPtr<AActor>> Owners;
+
+	UPROPERTY()
+	TArray<uint8> Flags;															/* EProjectileSimulationFlags */
+
+	UPROPERTY()
+	TArray<int32> DenseToSlot;
+
+	// -- Public Information -- Sparse Properties, one per slot -- //
+public:
+	FProjectileSimulationSlotPool Slots;											/* The dense index of each live slot, grown only through Grow */
+
+	// -- Public Information -- Struct Methods -- //
+public:
+	/* The number of live projectiles */
+	int32 Num() const { return PositionsX.Num(); }
+
+	/* Gets the position of the projectile at a dense index */
+	FVector GetPosition(int32 DenseIndex) const { return FVector(PositionsX[DenseIndex], PositionsY[DenseIndex], PositionsZ[DenseIndex]); }
+
+	/* Gets the velocity of the projectile at a dense index */
+	FVector GetVelocity(int32 DenseIndex) const { return FVector(VelocitiesX[DenseIndex], VelocitiesY[DenseIndex], VelocitiesZ[DenseIndex]); }
+
+	/* Sets the position of the projectile at a dense index */
+	void SetPosition(int32 DenseIndex, const FVector& InPosition)
+	{
+		PositionsX[DenseIndex] = InPosition.X;
+		PositionsY[DenseIndex] = InPosition.Y;
+		PositionsZ[DenseIndex] = InPosition.Z;
+	}
+
+	/* Sets the velocity of the projectile at a dense index */
+	void SetVelocity(int32 DenseIndex, const FVector& InVelocity)
+	{
+		VelocitiesX[DenseIndex] = InVelocity.X;
+		VelocitiesY[DenseIndex] = InVelocity.Y;
+		VelocitiesZ[DenseIndex] = InVelocity.Z;
+	}
+
+	/* The number of slots, live or free */
+	int32 GetCapacity() const { return Slots.GetCapacity(); }
+
+	/* Is there room for another projectile? */
+	bool HasFreeSlot() const { return Slots.NumFree() > 0; }
+
+	/* Does the projectile at the dense index have the flag set? */
+	bool HasFlag(int32 DenseIndex, EProjectileSimulationFlags::Type Flag) const { return (Flags[DenseIndex] & Flag) != 0; }
+
+	/* Clears everything and allocates the requested number of slots */
+	void Initialize(int32 InCapacity);
+
+	/* Adds slots up to the new capacity, live projectiles are untouched */
+	bool Grow(int32 InNewCapacity);
+
+	/* Clears everything and frees the storage */
+	void Reset();
+
+	/* Adds a projectile from a pool request, false if there are no free slots */
+	bool Add(const FProjectilePoolRequest& InRequest, float InCollisionRadius, FProjectileHandle& OutHandle);
+
+	/* Resolves a handle to its dense index, -1 if the handle is stale */
+	int32 ResolveHandle(const FProjectileHandle& InHandle) const;
+
+	/* Gets the handle for the live projectile at a dense index */
+	FProjectileHandle GetHandle(int32 DenseIndex) const;
+
+	/* Removes the live projectile at a dense index, the last live projectile is swapped in */
+	void RemoveAtDense(int32 DenseIndex);
+
+public:
+	FProjectileSimulationData()
+	{}
+};
+
+/*	What one parallel simulation chunk found while it was stepped. 
+	Every chunk owns its own result so the workers never share a buffer, the game thread 
+	merges them once all of the chunks are done. 
+*/
+struct FProjectileSimulationChunkResult
+{
+	// -- Public Information -- Properties -- //
+public:
+	TArray<int32> Expired;															/* Dense indexs that expired, ascending */
+
+	// -- Public Information -- Methods -- //
+public:
+	/* Clears the result, keeping the allocation for the next frame */
+	void Reset()
+	{
+		Expired.Reset();
+	}
+};
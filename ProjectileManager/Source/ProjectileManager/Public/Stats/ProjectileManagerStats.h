@@ -0,0 +1,90 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Stats Group, shown with "stat ProjectileManager"				-
+//-----------------------------------------------------------------------------------
+DECLARE_STATS_GROUP(TEXT("ProjectileManager"), STATGROUP_ProjectileManager, STATCAT_Advanced);
+
+// -- Per call timing
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Acquire"), STAT_ProjectileAcquire, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Acquire Burst"), STAT_ProjectileAcquireBurst, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Return"), STAT_ProjectileReturn, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Return Pass"), STAT_ProjectileReturnPass, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update From Pool"), STAT_ProjectileUpdateFromPool, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Create Pool"), STAT_ProjectileCreatePool, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn"), STAT_ProjectileSpawn, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resize Pool"), STAT_ProjectileResizePool, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+
+// -- Per frame passes
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Commands"), STAT_ProjectileAsyncCommands, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Fire Commands"), STAT_ProjectileFireCommands, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Batched Tick"), STAT_ProjectileBatchedTick, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Simulate Data"), STAT_ProjectileSimulateData, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Issue Sweeps"), STAT_ProjectileIssueSweeps, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Consume Sweeps"), STAT_ProjectileConsumeSweeps, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Expiry"), STAT_ProjectileExpiry, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Significance"), STAT_ProjectileSignificance, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Instance Update"), STAT_ProjectileInstanceUpdate, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+
+// -- Per frame counts, reset every frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Acquires"), STAT_ProjectileAcquires, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Returns"), STAT_ProjectileReturns, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Acquire Misses"), STAT_ProjectileAcquireMisses, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Acquire Failures"), STAT_ProjectileAcquireFailures, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Return Misses"), STAT_ProjectileReturnMisses, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawned"), STAT_ProjectileSpawned, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Destroyed"), STAT_ProjectileDestroyed, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Collision Sets"), STAT_ProjectileCollisionSets, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Tick Sets"), STAT_ProjectileTickSets, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hidden Sets"), STAT_ProjectileHiddenSets, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+
+// -- Occupancy, the last value set
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("In Use"), STAT_ProjectileInUse, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pool Size"), STAT_ProjectilePoolSize, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Rendered Instances"), STAT_ProjectileRenderedInstances, STATGROUP_ProjectileManager, PROJECTILEMANAGER_API);
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager CSV Category, captured with "-csvCategories=ProjectileManager"	-
+//-----------------------------------------------------------------------------------
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(PROJECTILEMANAGER_API, ProjectileManager);
+
+
+//-----------------------------------------------------------------------------------
+// Projectile Manager Stat Macros, each feeds the stats group and the CSV category	-
+//-----------------------------------------------------------------------------------
+/* Times the rest of the scope, Name is the cycle stat without its STAT_Projectile prefix */
+#define PROJECTILE_SCOPE_STAT(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_Projectile##Name); \
+	CSV_SCOPED_TIMING_STAT(ProjectileManager, Name)
+
+/* Adds to a per frame count */
+#define PROJECTILE_COUNT_STAT(Name, Amount) \
+	do { INC_DWORD_STAT_BY(STAT_Projectile##Name, Amount); CSV_CUSTOM_STAT(ProjectileManager, Name, int32(Amount), ECsvCustomStatOp::Accumulate); } while (0)
+
+/* Sets an occupancy value */
+#define PROJECTILE_SET_STAT(Name, Value) \
+	do { SET_DWORD_STAT(STAT_Projectile##Name, Value); CSV_CUSTOM_STAT(ProjectileManager, Name, int32(Value), ECsvCustomStatOp::Set); } while (0)
@@ -0,0 +1,73 @@
+/*	Copyright / License  Disclaimer
+*	MIT Copyright 2020 Nicholas Mallonee
+*	Permission is hereby granted, free of charge, to any person obtaining a
+*	copy of this software and associated documentation files(the "Software"), to deal
+*	in the Software without restriction, including without limitation the rights to use,
+*	copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the
+*	Software, and to permit persons to whom the Software is furnished to do so, subject
+*	to the following conditions :
+*	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+*
+*	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+*	INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+*	PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+*	FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+*	OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+*	OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProjectileManagerSubsystem.generated.h"
+
+class AProjectileManagerBase;
+
+/*
+ * A world subsystem the projectile managers register with while they are playing. 
+ * Lets anything find a manager without walking the worlds actors, the lookup is a pointer 
+ * read, or a single map find when several managers are told apart by their tag. 
+ */
+UCLASS()
+class PROJECTILEMANAGER_API UProjectileManagerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	// -- Public Information -- Subsystem Methods -- //
+public:
+	/* Gets the subsystem of the context objects world */
+	static UProjectileManagerSubsystem* Get(const UObject* ContextObject);
+
+	/* Engine deinitialize event */
+	virtual void Deinitialize() override;
+
+	/* Registers a manager, called by the manager on begin play */
+	void Request_RegisterManager(AProjectileManagerBase* InManager);
+
+	/* Unregisters a manager, called by the manager on end play */
+	void Request_UnregisterManager(AProjectileManagerBase* InManager);
+
+	/* Gets the first registered manager still playing */
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager")
+	AProjectileManagerBase* GetProjectileManager() const { return PrimaryManager; }
+
+	/* Gets the manager registered with a tag */
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager")
+	AProjectileManagerBase* GetProjectileManagerByTag(FName InManagerTag) const;
+
+	/* Gets the number of registered managers */
+	UFUNCTION(BlueprintPure, Category = "Projectile Manager")
+	int32 GetNumProjectileManagers() const { return Managers.Num(); }
+
+	// -- Private Information -- Properties -- //
+private:
+	UPROPERTY()
+	TArray<AProjectileManagerBase*> Managers;							/* Every registered manager, in registration order */
+
+	UPROPERTY()
+	TMap<FName, AProjectileManagerBase*> ManagersByTag;					/* The tagged managers, the first to register a tag keeps it while it plays */
+
+	UPROPERTY()
+	AProjectileManagerBase* PrimaryManager = nullptr;					/* Handed out by the untagged lookup */
+};